@@ -0,0 +1,114 @@
+#!/bin/bash
+# Runs every kernel binary of a channel matrix built with "make chmatrix" and prints the bandwidth of the channelized kernels at every
+# channel depth and width, next to that of their unchannelized counterpart from the same folder, followed by the minimum depth at
+# which the channelized kernel matches or beats it
+# Usage: benchmark_channels.sh [folder] [--profile]; the folder defaults to the one of benchmark_fpga.sh
+
+export CL_CONTEXT_COMPILER_MODE_ALTERA=3
+
+iter=5
+size=1024
+indexes=$(($size * 256 * 1024))
+sqrt=`echo "e(l($indexes)/2)" | bc -l`
+cbrt=`echo "e(l($indexes)/3)" | bc -l`
+dim_x_2d=`echo "x=l($sqrt)/l(2); scale=0; if (x%1 != 0) x = (x + 1); x = (x / 1); 2 ^ x" | bc -l`
+dim_y_2d=$(( $indexes / $dim_x_2d ))
+dim_x_3d=`echo "x=l($cbrt)/l(2); scale=0; if (x%1 != 0) x = (x + 1); x = (x / 1); 2 ^ x" | bc -l`
+dim_y_3d=$dim_x_3d
+dim_z_3d=$(( $indexes / ($dim_x_3d * dim_y_3d) ))
+folder=""
+profile=""
+source="host"
+for arg in "$@"
+do
+	if [[ "$arg" == "--profile" ]]
+	then
+		profile="--profile"
+		source="device"
+	else
+		folder=$arg
+	fi
+done
+if [[ -z "$folder" ]]
+then
+	board=`aoc --list-boards | grep Board -A 2 | sed -n 2p | tr -d ' ' | cut -d "_" -f 1`
+	version=`aoc --version | grep Build | cut -d " " -f 2`
+	folder=`echo "$board"_"$version"`
+fi
+results=`mktemp`
+
+# the host reads the kernel configuration, including channel depth and width, from the name of the kernel binary
+make clean >/dev/null 2>&1; make host INTEL_FPGA=1 >/dev/null 2>&1
+
+for i in `ls $folder | grep aocx | sort -V`
+do
+	name="${i%.*}"
+	type=`echo $name | cut -d "-" -f 5 | cut -d "_" -f 1`
+
+	if [[ "$type" == "std" ]] || [[ "$type" == "chstd" ]]
+	then
+		size_switch="-s $size"
+	elif [[ "$type" == "blk2d" ]] || [[ "$type" == "chblk2d" ]]
+	then
+		size_switch="-x $dim_x_2d -y $dim_y_2d"
+	elif [[ "$type" == "blk3d" ]] || [[ "$type" == "chblk3d" ]]
+	then
+		size_switch="-x $dim_x_3d -y $dim_y_3d -z $dim_z_3d"
+	else
+		continue
+	fi
+
+	aocl program acl0 "$folder/$i" >/dev/null 2>&1
+	DEVICE_TYPE=FPGA ./fpga-mem-bench -aocx "$folder/$i" $size_switch -n $iter --format csv $profile 2>/dev/null | grep -E "^(type|$type)," >> $results
+done
+
+# the counterpart of a channelized kernel has the same type without "ch", model, vector size, element type, block size and kernel
+grep "^type," $results | head -n 1 | cat - <(grep -v "^type," $results) | awk -F, -v source="$source" '
+NR == 1 {
+	for (c = 1; c <= NF; c++) col[$c] = c
+	next
+}
+$col["copy"] == "" {
+	type = $col["type"]; base = type; sub(/^ch/, "", base)
+	key = base SUBSEP $col["model"] SUBSEP $col["vec"] SUBSEP $col["dtype"] SUBSEP $col["block_x"] SUBSEP $col["block_y"] SUBSEP $col["kernel"]
+	bw = $col[source "_mean"]
+	if ($col["chan_depth"] == "")
+	{
+		unchannelized[key] = bw
+		next
+	}
+	row = type SUBSEP key SUBSEP $col["chan_width"]
+	if (!(row in rows)) order[++count] = row
+	rows[row] = 1
+	depths[row] = depths[row] " " $col["chan_depth"]
+	result[row, $col["chan_depth"]] = bw
+}
+END {
+	printf "%-9s%-7s%-5s%-8s%-7s%-9s%-7s%-11s%-11s%-9s\n", "Type", "Model", "VEC", "DType", "Width", "Kernel", "Depth", "GB/s", "Unch. GB/s", "Ratio"
+	for (r = 1; r <= count; r++)
+	{
+		split(order[r], f, SUBSEP)
+		key = f[2] SUBSEP f[3] SUBSEP f[4] SUBSEP f[5] SUBSEP f[6] SUBSEP f[7] SUBSEP f[8]
+		n = split(depths[order[r]], d, " ")
+		minimum[order[r]] = "none"
+		for (i = 1; i <= n; i++)
+		{
+			bw = result[order[r], d[i]]
+			ratio = (key in unchannelized && unchannelized[key] > 0) ? sprintf("%.3f", bw / unchannelized[key]) : "N/A"
+			printf "%-9s%-7s%-5s%-8s%-7s%-9s%-7s%-11.3f%-11s%-9s\n", toupper(f[1]), f[3], f[4], f[5], f[9], f[8], d[i], bw, (key in unchannelized) ? sprintf("%.3f", unchannelized[key]) : "N/A", ratio
+			if (key in unchannelized && bw >= unchannelized[key] && (minimum[order[r]] == "none" || d[i] + 0 < minimum[order[r]] + 0)) minimum[order[r]] = d[i]
+		}
+	}
+
+	printf "\nMinimum channel depth that matches the unchannelized kernel:\n"
+	printf "%-9s%-7s%-5s%-8s%-7s%-9s%-7s\n", "Type", "Model", "VEC", "DType", "Width", "Kernel", "Depth"
+	for (r = 1; r <= count; r++)
+	{
+		split(order[r], f, SUBSEP)
+		printf "%-9s%-7s%-5s%-8s%-7s%-9s%-7s\n", toupper(f[1]), f[3], f[4], f[5], f[9], f[8], minimum[order[r]]
+	}
+}'
+
+rm -f $results
+
+unset CL_CONTEXT_COMPILER_MODE_ALTERA
@@ -66,6 +66,9 @@ then
 fi
 echo
 
+# the host reads the kernel configuration from the name of the kernel binary, so it is only compiled once
+make clean >/dev/null 2>&1; make host INTEL_FPGA=1 >/dev/null 2>&1
+
 for i in `ls $folder | grep aocx | sort -V`
 do
 	name="${i%.*}"
@@ -80,10 +83,8 @@ do
 
 	if [[ `echo $name | cut -d "_" -f 2` == NDR ]]
 	then
-		ndr=1
 		model=NDR
 	else
-		ndr=0
 		model=SWI
 	fi
 
@@ -91,10 +92,8 @@ do
 
 	if [[ -n `echo $name | grep nointer` ]]
 	then
-		nointer=1
 		inter=N
 	else
-		nointer=0
 		inter=Y
 	fi
 
@@ -107,7 +106,6 @@ do
 
 	freq=`cat $folder/$name/acl_quartus_report.txt | grep Actual | cut -d " " -f 4 | xargs printf %0.2f`
 
-	make clean >/dev/null 2>&1; make $type INTEL_FPGA=1 HOST_ONLY=1 VEC=$VEC BSIZE=$BSIZE NO_INTER=$nointer NDR=$ndr >/dev/null 2>&1
 	rm fpga-mem-bench-kernel.aocx >/dev/null 2>&1
 	ln -s "$folder/$i" fpga-mem-bench-kernel.aocx
 	aocl program acl0 fpga-mem-bench-kernel.aocx >/dev/null 2>&1
@@ -141,16 +139,21 @@ do
 			dim=$size
 		fi
 
+		# all padding values are run by a single in-process sweep; results of the n-th value are the n-th match in the output
+		pad_list=`echo "${pad_array[@]}" | tr " " ","`
+		out=`DEVICE_TYPE=FPGA ./fpga-mem-bench -bsize $BSIZE $size_switch -n $iter -pad $pad_list $halo_switch $verify 2>&1`
+		#echo "$out" >> ast.txt
+
+		n=0
 		#for ((pad = $pad_start ; pad <= $pad_end ; pad++))
 		for pad in "${pad_array[@]}"
 		do
-			out=`DEVICE_TYPE=FPGA ./fpga-mem-bench $size_switch -n $iter -pad $pad $halo_switch $verify 2>&1`
-			#echo "$out" >> ast.txt
+			n=$(($n + 1))
 
-			R1W1=`echo "$out" | grep "R1W1:" | cut -d " " -f 2`
-			R2W1=`echo "$out" | grep "R2W1:" | cut -d " " -f 2`
-			R3W1=`echo "$out" | grep "R3W1:" | cut -d " " -f 2`
-			R2W2=`echo "$out" | grep "R2W2:" | cut -d " " -f 2`
+			R1W1=`echo "$out" | grep "R1W1:" | sed -n "$n"p | cut -d " " -f 2`
+			R2W1=`echo "$out" | grep "R2W1:" | sed -n "$n"p | cut -d " " -f 2`
+			R3W1=`echo "$out" | grep "R3W1:" | sed -n "$n"p | cut -d " " -f 2`
+			R2W2=`echo "$out" | grep "R2W2:" | sed -n "$n"p | cut -d " " -f 2`
 
 			bw_R1W1=`echo "$freq * $VEC * 4 * 2 / 1000" | bc -l | xargs printf %0.3f`
 			if [[ `echo "$bw_R1W1 > $max_bw" | bc -l` -eq 1 ]]
@@ -178,14 +181,14 @@ do
 			R3W1_eff=`echo "100 * ($R3W1/$bw_R3W1)" | bc -l | xargs printf %0.1f`
 			R2W2_eff=`echo "100 * ($R2W2/$bw_R2W2)" | bc -l | xargs printf %0.1f`
 
-			R1W1_ver=`echo "$out" | grep Verify | grep R1W1 | cut -d " " -f 4 | cut -c 1-1`
-			R2W1_ver=`echo "$out" | grep Verify | grep R2W1 | cut -d " " -f 4 | cut -c 1-1`
-			R3W1_ver=`echo "$out" | grep Verify | grep R3W1 | cut -d " " -f 4 | cut -c 1-1`
-			R2W2_ver=`echo "$out" | grep Verify | grep R2W2 | cut -d " " -f 4 | cut -c 1-1`
+			R1W1_ver=`echo "$out" | grep Verify | grep R1W1 | sed -n "$n"p | cut -d " " -f 4 | cut -c 1-1`
+			R2W1_ver=`echo "$out" | grep Verify | grep R2W1 | sed -n "$n"p | cut -d " " -f 4 | cut -c 1-1`
+			R3W1_ver=`echo "$out" | grep Verify | grep R3W1 | sed -n "$n"p | cut -d " " -f 4 | cut -c 1-1`
+			R2W2_ver=`echo "$out" | grep Verify | grep R2W2 | sed -n "$n"p | cut -d " " -f 4 | cut -c 1-1`
 
 			if [[ "$type" == "std" ]] || [[ "$type" == "chstd" ]]
 			then
-				R1W0=`echo "$out" | grep "R1W0:" | cut -d " " -f 2`
+				R1W0=`echo "$out" | grep "R1W0:" | sed -n "$n"p | cut -d " " -f 2`
 
 				bw_R1W0=`echo "$freq * $VEC * 4 * 1 / 1000" | bc -l | xargs printf %0.3f`
 				if [[ `echo "$bw_R1W0 > $max_bw" | bc -l` -eq 1 ]]
@@ -64,7 +64,7 @@ then
 fi
 echo
 
-ndr=1
+model=NDR
 VEC=1
 if [[ $gpu == "V100" ]]
 then
@@ -87,7 +87,7 @@ else
 	max_bw=249.6
 fi
 
-make clean >/dev/null 2>&1; make $type NVIDIA=1 VEC=$VEC BSIZE=$BSIZE NDR=$ndr >/dev/null 2>&1
+make clean >/dev/null 2>&1; make host NVIDIA=1 >/dev/null 2>&1
 
 #for ((halo = $halo_start ; halo <= $halo_end ; halo += $halo_step))
 for halo in "${halo_array[@]}"
@@ -118,32 +118,37 @@ do
 		dim=$size
 	fi
 
+	# all padding values are run by a single in-process sweep; results of the n-th value are the n-th match in the output
+	pad_list=`echo "${pad_array[@]}" | tr " " ","`
+	out=`DEVICE_TYPE=GPU ./fpga-mem-bench -type $type -model $model -vec $VEC -bsize $BSIZE $size_switch -n $iter -pad $pad_list $halo_switch -id $gpu_id $verify 2>&1`
+	#echo "$out" >> ast.txt
+
+	n=0
 	#for ((pad = $pad_start ; pad <= $pad_end ; pad++))
 	for pad in "${pad_array[@]}"
 	do
-		out=`DEVICE_TYPE=GPU ./fpga-mem-bench $size_switch -n $iter -pad $pad $halo_switch -id $gpu_id $verify 2>&1`
-		#echo "$out" >> ast.txt
+		n=$(($n + 1))
 
-		redundancy=`echo "$out" | grep "Redundancy:" | cut -d " " -f 2`
+		redundancy=`echo "$out" | grep "Redundancy:" | sed -n "$n"p | cut -d " " -f 2`
 
-		R1W1=`echo "$out" | grep "R1W1:" | cut -d " " -f 2`
-		R2W1=`echo "$out" | grep "R2W1:" | cut -d " " -f 2`
-		R3W1=`echo "$out" | grep "R3W1:" | cut -d " " -f 2`
-		R2W2=`echo "$out" | grep "R2W2:" | cut -d " " -f 2`
+		R1W1=`echo "$out" | grep "R1W1:" | sed -n "$n"p | cut -d " " -f 2`
+		R2W1=`echo "$out" | grep "R2W1:" | sed -n "$n"p | cut -d " " -f 2`
+		R3W1=`echo "$out" | grep "R3W1:" | sed -n "$n"p | cut -d " " -f 2`
+		R2W2=`echo "$out" | grep "R2W2:" | sed -n "$n"p | cut -d " " -f 2`
 
 		R1W1_eff=`echo "100 * ($R1W1/$max_bw)" | bc -l | xargs printf %0.1f`
 		R2W1_eff=`echo "100 * ($R2W1/$max_bw)" | bc -l | xargs printf %0.1f`
 		R3W1_eff=`echo "100 * ($R3W1/$max_bw)" | bc -l | xargs printf %0.1f`
 		R2W2_eff=`echo "100 * ($R2W2/$max_bw)" | bc -l | xargs printf %0.1f`
 
-		R1W1_ver=`echo "$out" | grep Verify | grep R1W1 | cut -d " " -f 4 | cut -c 1-1`
-		R2W1_ver=`echo "$out" | grep Verify | grep R2W1 | cut -d " " -f 4 | cut -c 1-1`
-		R3W1_ver=`echo "$out" | grep Verify | grep R3W1 | cut -d " " -f 4 | cut -c 1-1`
-		R2W2_ver=`echo "$out" | grep Verify | grep R2W2 | cut -d " " -f 4 | cut -c 1-1`
+		R1W1_ver=`echo "$out" | grep Verify | grep R1W1 | sed -n "$n"p | cut -d " " -f 4 | cut -c 1-1`
+		R2W1_ver=`echo "$out" | grep Verify | grep R2W1 | sed -n "$n"p | cut -d " " -f 4 | cut -c 1-1`
+		R3W1_ver=`echo "$out" | grep Verify | grep R3W1 | sed -n "$n"p | cut -d " " -f 4 | cut -c 1-1`
+		R2W2_ver=`echo "$out" | grep Verify | grep R2W2 | sed -n "$n"p | cut -d " " -f 4 | cut -c 1-1`
 
 		if [[ "$type" == "std" ]]
 		then
-			R1W0=`echo "$out" | grep "R1W0:" | cut -d " " -f 2`
+			R1W0=`echo "$out" | grep "R1W0:" | sed -n "$n"p | cut -d " " -f 2`
 
 			R1W0_eff=`echo "100 * ($R1W0/$max_bw)" | bc -l | xargs printf %0.1f`
 
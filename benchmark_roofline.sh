@@ -0,0 +1,82 @@
+#!/bin/bash
+# Runs every channelized compute pipeline binary built with "make chfma" over its default sweep of FMA chain lengths and prints the
+# measured roofline of every binary: bandwidth and GFLOP/s against arithmetic intensity, next to the compute roof of the binary at
+# its fmax and the memory roof measured with an empty chain
+# Usage: benchmark_roofline.sh [folder] [--profile]; the folder defaults to the one of benchmark_fpga.sh
+# The sweep can be changed through the FMA environment variable, e.g. FMA="0:64:*2"; FMAs beyond those of the binary are rejected
+
+export CL_CONTEXT_COMPILER_MODE_ALTERA=3
+
+iter=5
+size=1024
+folder=""
+profile=""
+source="host"
+for arg in "$@"
+do
+	if [[ "$arg" == "--profile" ]]
+	then
+		profile="--profile"
+		source="device"
+	else
+		folder=$arg
+	fi
+done
+if [[ -z "$folder" ]]
+then
+	board=`aoc --list-boards | grep Board -A 2 | sed -n 2p | tr -d ' ' | cut -d "_" -f 1`
+	version=`aoc --version | grep Build | cut -d " " -f 2`
+	folder=`echo "$board"_"$version"`
+fi
+fma_switch=""
+if [[ -n "$FMA" ]]
+then
+	fma_switch="-fma $FMA"
+fi
+results=`mktemp`
+
+# the host reads the kernel configuration, including the FMAs of the chain, from the name of the kernel binary
+make clean >/dev/null 2>&1; make host INTEL_FPGA=1 >/dev/null 2>&1
+
+for i in `ls $folder | grep aocx | grep chfma | sort -V`
+do
+	aocl program acl0 "$folder/$i" >/dev/null 2>&1
+	DEVICE_TYPE=FPGA ./fpga-mem-bench -aocx "$folder/$i" -s $size $fma_switch -n $iter --format csv $profile 2>/dev/null | grep -E "^(type|chfma)," | sed "s|\$|,$i|" >> $results
+done
+
+# every byte is read once and written once, so the pipeline performs 2 * fmas FLOPs per 8 bytes of a float element
+grep "^type," $results | head -n 1 | cat - <(grep -v "^type," $results) | awk -F, -v source="$source" '
+NR == 1 {
+	for (c = 1; c <= NF; c++) col[$c] = c
+	col["binary"] = NF
+	next
+}
+$col["copy"] == "" {
+	binary = $col["binary"]
+	if (!(binary in rows)) order[++count] = binary
+	rows[binary] = rows[binary] " " NR
+	bw[NR] = $col[source "_mean"]
+	fmas[NR] = $col["fmas"]
+	intensity[NR] = $col["flops"] / $col["bytes"]
+	gflops[NR] = bw[NR] * intensity[NR]
+	roof[NR] = ($col["fmax"] != "") ? $col["fmax"] * $col["vec"] * 2 * $col["fmas"] / 1000 : -1
+	if ($col["fmas"] == 0) memory[binary] = bw[NR]
+}
+END {
+	for (b = 1; b <= count; b++)
+	{
+		printf "%s%s\n", (b > 1) ? "\n" : "", order[b]
+		printf "%-6s%-11s%-11s%-11s%-13s%-11s\n", "FMAs", "FLOP/byte", "GB/s", "GFLOP/s", "Roof GFLOP/s", "Mem. ratio"
+		n = split(rows[order[b]], r, " ")
+		for (i = 1; i <= n; i++)
+		{
+			k = r[i]
+			ratio = (order[b] in memory && memory[order[b]] > 0) ? sprintf("%.3f", bw[k] / memory[order[b]]) : "N/A"
+			printf "%-6s%-11.3f%-11.3f%-11.3f%-13s%-11s\n", fmas[k], intensity[k], bw[k], gflops[k], (roof[k] < 0) ? "N/A" : sprintf("%.3f", roof[k]), ratio
+		}
+	}
+}'
+
+rm -f $results
+
+unset CL_CONTEXT_COMPILER_MODE_ALTERA
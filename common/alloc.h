@@ -0,0 +1,131 @@
+//====================================================================================================================================
+// Allocation of host buffers: regular heap, transparent or explicit huge pages, and page-locked memory
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef ALLOC_H
+#define ALLOC_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "numa.h"
+
+#ifdef __linux
+	#include <sys/mman.h>
+#endif
+
+// Host buffer allocation modes; host memory of ALLOC_CL_HOST is allocated by the OpenCL runtime and mapped (see bench.h)
+enum {ALLOC_HEAP, ALLOC_THP, ALLOC_HUGE_2M, ALLOC_HUGE_1G, ALLOC_MLOCK, ALLOC_CL_HOST, NUM_ALLOC};
+static const char* const alloc_names[NUM_ALLOC] = {"heap", "thp", "huge2m", "huge1g", "mlock", "clhost"};
+
+#define HUGE_PAGE_2M (2UL * 1024 * 1024)
+#define HUGE_PAGE_1G (1024UL * 1024 * 1024)
+
+#ifndef MAP_HUGE_SHIFT
+	#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+	#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+	#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+// Returns the index of the given allocation mode name, or -1 if unknown
+inline static int parse_alloc(const char* name)
+{
+	for (int i = 0; i < NUM_ALLOC; i++)
+	{
+		if (strcmp(name, alloc_names[i]) == 0)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+// Size of the memory actually allocated for a buffer of "size" bytes, which is rounded up to whole pages of the mode
+inline static size_t alloc_length(size_t size, int mode)
+{
+	size_t page = (mode == ALLOC_HUGE_1G) ? HUGE_PAGE_1G : (mode == ALLOC_HUGE_2M || mode == ALLOC_THP) ? HUGE_PAGE_2M : (size_t)sysconf(_SC_PAGESIZE);
+	return (size + page - 1) / page * page;
+}
+
+// Allocates a host buffer with the given mode and NUMA placement; the placement is set before any page is touched
+// Page-locked buffers are populated by mlock() from the calling thread, so their first-touch placement is that of this thread
+inline static void* host_alloc(size_t size, int mode, int node)
+{
+	void* ptr = NULL;
+	size_t length = alloc_length(size, mode);
+
+#ifdef __linux
+	if (mode == ALLOC_HUGE_2M || mode == ALLOC_HUGE_1G)
+	{
+		ptr = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | ((mode == ALLOC_HUGE_1G) ? MAP_HUGE_1GB : MAP_HUGE_2MB), -1, 0);
+		if (ptr == MAP_FAILED)
+		{
+			printf("ERROR: mmap() of %zu MiB with %s huge pages failed; reserve enough pages in /sys/kernel/mm/hugepages/hugepages-%s/nr_hugepages.\n", length / (1024 * 1024), (mode == ALLOC_HUGE_1G) ? "1 GiB" : "2 MiB", (mode == ALLOC_HUGE_1G) ? "1048576kB" : "2048kB");
+			exit(-1);
+		}
+		numa_bind(ptr, length, node);
+		return ptr;
+	}
+#endif
+
+	// regular heap buffers are only page-aligned if their placement has to be set
+	size_t alignment = (mode == ALLOC_THP) ? HUGE_PAGE_2M : (mode == ALLOC_HEAP && node == NUMA_LOCAL) ? 64 : (size_t)sysconf(_SC_PAGESIZE);
+	if (posix_memalign(&ptr, alignment, (mode == ALLOC_HEAP) ? size : length))
+	{
+		fprintf(stderr, "Aligned Malloc failed due to insufficient memory.\n");
+		exit(-1);
+	}
+	if (mode == ALLOC_HEAP && node == NUMA_LOCAL)
+	{
+		return ptr;
+	}
+	numa_bind(ptr, length, node);
+
+#ifdef __linux
+	if (mode == ALLOC_THP && madvise(ptr, length, MADV_HUGEPAGE) != 0)
+	{
+		perror("ERROR: madvise(MADV_HUGEPAGE) failed; transparent huge pages are not available");
+		exit(-1);
+	}
+	if (mode == ALLOC_MLOCK && mlock(ptr, length) != 0)
+	{
+		perror("ERROR: mlock() failed; the limit of locked memory may need to be raised with \"ulimit -l\"");
+		exit(-1);
+	}
+#else
+	if (mode != ALLOC_HEAP)
+	{
+		printf("Allocation mode \"%s\" is only supported on Linux!\n", alloc_names[mode]);
+		exit(-1);
+	}
+#endif
+	return ptr;
+}
+
+inline static void host_free(void* ptr, size_t size, int mode)
+{
+#ifdef __linux
+	size_t length = alloc_length(size, mode);
+	if (mode == ALLOC_HUGE_2M || mode == ALLOC_HUGE_1G)
+	{
+		munmap(ptr, length);
+		return;
+	}
+	if (mode == ALLOC_MLOCK)
+	{
+		munlock(ptr, length);
+	}
+#else
+	(void) size; (void) mode;
+#endif
+	free(ptr);
+}
+
+#endif // ALLOC_H
@@ -0,0 +1,1859 @@
+//====================================================================================================================================
+// Benchmark runner shared by all kernel families: context and queue pool, buffer set, kernel registry, timed executor, verifier
+// and reporter; each family plugs in as a descriptor (family_t) that only defines its kernels, geometry and size arguments
+// Kernels run on an OpenCL device, or on the host CPU with the native backend in cpu.h
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <limits.h>
+#include <math.h>
+#include <omp.h>
+#include <CL/cl.h>
+
+#include "util.h"
+#include "timer.h"
+#include "stats.h"
+#include "report.h"
+#include "sweep.h"
+#include "cpu.h"
+#include "numa.h"
+#include "alloc.h"
+#include "dtype.h"
+
+#ifdef INTEL_FPGA
+	#include "CL/cl_ext.h"
+
+	#ifdef LEGACY
+		#define MEM_BANK(n) CL_MEM_BANK_##n##_ALTERA
+	#else
+		#define MEM_BANK(n) CL_CHANNEL_##n##_INTELFPGA
+	#endif
+#else
+	#define MEM_BANK(n) 0 // manual buffer placement is only available on Intel FPGAs
+#endif
+
+#define KERNEL_NAME "fpga-mem-bench-kernel"
+#define MAX_BUFFERS 16
+#define MAX_KERNELS 8
+#define MAX_COPIES  8 // largest number of copies of a kernel run concurrently
+#define MAX_QUEUES  (3 * MAX_COPIES) // channelized families run their read, compute and write kernels in separate queues, every copy in its own
+#define MAX_EVENTS  MAX_QUEUES // events whose span is the device-side run time of one run
+#define MAX_BANKS   7 // memory banks that buffers can be placed in when interleaving is disabled, the most the runtime can address
+#define MAX_PLACEMENTS 4096 // largest number of bank placements run by the automatic placement mode
+
+// Backends that run the kernels
+enum {BACKEND_OPENCL, BACKEND_CPU, NUM_BACKENDS};
+static const char* const backend_names[NUM_BACKENDS] = {"opencl", "cpu"};
+
+// Swept parameters, in the order they are iterated from innermost to outermost
+enum {PARAM_PAD, PARAM_PAD_X, PARAM_PAD_Y, PARAM_HALO, PARAM_Z, PARAM_Y, PARAM_X, PARAM_SIZE, PARAM_CHUNK, PARAM_KIB, PARAM_STRIDE, PARAM_WINDOW, PARAM_READS, PARAM_WRITES, PARAM_TILE, PARAM_FMA, NUM_PARAMS};
+static const char* const param_options[NUM_PARAMS] = {"-pad", "-pad_x", "-pad_y", "-hw", "-z", "-y", "-x", "-s", "-chunk", "-kib", "-stride", "-window", "-reads", "-writes", "-tile", "-fma"};
+#define PARAM(p) (1u << (p))
+
+// How the outputs of a kernel are checked: not at all, each output against the input in the same position, every output against
+// the sum of all inputs, against the fill value, or against its value before the runs plus the fill value added once per run
+enum {VERIFY_NONE, VERIFY_COPY, VERIFY_SUM, VERIFY_FILL, VERIFY_INPLACE};
+
+// Buffers are named from A and listed in the order they are passed to the kernel; all other arguments follow the buffers
+typedef struct
+{
+	const char* name;
+	const char* buffers;       // buffer arguments of the kernel
+	const char* read_buffers;  // buffer arguments of the read kernel of channelized families, also the inputs of the kernel
+	const char* write_buffers; // buffer arguments of the write kernel of channelized families, also the outputs of the kernel
+	int write_sizes;           // whether the write kernel of channelized families takes the size arguments
+	int bytes;                 // bytes transferred per run as a multiple of the bytes accessed per buffer, zero if the buffers
+	                           // read and written are selected per sweep point
+	int verify;
+	int inplace;               // the output is also the input and is only written outside the halo, once per index
+} kernel_desc_t;
+
+// Read and write kernels implemented by every family; families without R1W0 start from the second entry
+// R0W1 fills its output with FILL_VALUE and R1W1IP adds FILL_VALUE to its buffer in place; only the std and blocked families
+// implement them
+static const kernel_desc_t standard_kernels[] = {
+	{"R1W0"  , "AD"  , "A"  , "D" , 0, 1, VERIFY_NONE   , 0},
+	{"R1W1"  , "AD"  , "A"  , "D" , 1, 2, VERIFY_COPY   , 0},
+	{"R2W1"  , "ABD" , "AB" , "D" , 1, 3, VERIFY_SUM    , 0},
+	{"R3W1"  , "ABCD", "ABC", "D" , 1, 4, VERIFY_SUM    , 0},
+	{"R2W2"  , "ABCD", "AB" , "CD", 1, 4, VERIFY_COPY   , 0},
+	{"R0W1"  , "D"   , ""   , "D" , 1, 1, VERIFY_FILL   , 0},
+	{"R1W1IP", "C"   , "C"  , "C" , 1, 2, VERIFY_INPLACE, 1}
+};
+
+// Generated RnWm kernel of a kernel file built with READS and WRITES (fpga-mem-bench-kernel-rw.h), which replaces the standard
+// kernels; its inputs are the first buffers and its outputs the ones that follow them
+#define RW_MAX 8 // largest number of inputs and of outputs
+
+typedef struct
+{
+	char name[8];
+	char buffers[2 * RW_MAX + 1];
+	char inputs[RW_MAX + 1];
+	kernel_desc_t desc;
+} rw_kernel_t;
+
+inline static void init_rw_kernel(rw_kernel_t* rw, int reads, int writes)
+{
+	memset(rw, 0, sizeof(rw_kernel_t));
+	sprintf(rw->name, "R%dW%d", reads, writes);
+	for (int b = 0; b < reads + writes; b++)
+	{
+		rw->buffers[b] = 'A' + b;
+	}
+	memcpy(rw->inputs, rw->buffers, reads);
+
+	kernel_desc_t desc = {rw->name, rw->buffers, rw->inputs, rw->buffers + reads, 1, reads + writes, (reads > 0) ? VERIFY_SUM : VERIFY_FILL, 0};
+	rw->desc = desc;
+}
+
+// buffers are placed in alternating banks when interleaving is disabled, unless their banks are given
+static const cl_mem_flags buffer_banks[MAX_BANKS] = {MEM_BANK(1), MEM_BANK(2), MEM_BANK(3), MEM_BANK(4), MEM_BANK(5), MEM_BANK(6), MEM_BANK(7)};
+
+// Locality of the indexes of indirect kernels; every index buffer is a permutation of the array, so scattered writes never collide
+// LOCALITY_BLOCK shuffles the indexes within consecutive windows, LOCALITY_JITTER moves every index by less than a window from its
+// sorted position
+enum {LOCALITY_LINEAR, LOCALITY_RANDOM, LOCALITY_BLOCK, LOCALITY_JITTER, NUM_LOCALITY};
+static const char* const locality_names[NUM_LOCALITY] = {"linear", "random", "block", "jitter"};
+
+// Returns the index of the given locality name, or -1 if unknown
+inline static int parse_locality(const char* name)
+{
+	for (int i = 0; i < NUM_LOCALITY; i++)
+	{
+		if (strcmp(name, locality_names[i]) == 0)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+// Parses a bank placement "A=1,B=2,..." into the bank of every buffer, or "auto[:<banks>]" to run every placement in the given
+// number of banks, two by default; returns that number for "auto", zero for a placement and -1 if invalid
+inline static int parse_banks(const char* spec, int* banks)
+{
+	int count = 2, length = 0;
+
+	memset(banks, 0, MAX_BUFFERS * sizeof(int));
+	if (strncmp(spec, "auto", 4) == 0)
+	{
+		if (spec[4] != '\0' && (sscanf(spec + 4, ":%d%n", &count, &length) != 1 || spec[4 + length] != '\0'))
+		{
+			return -1;
+		}
+		return (count >= 2 && count <= MAX_BANKS) ? count : -1;
+	}
+
+	for (const char* s = spec; ; s++)
+	{
+		char buffer;
+		int bank;
+		if (sscanf(s, "%c=%d%n", &buffer, &bank, &length) != 2 || buffer < 'A' || buffer >= 'A' + MAX_BUFFERS || bank < 1 || bank > MAX_BANKS)
+		{
+			return -1;
+		}
+		banks[buffer - 'A'] = bank;
+		s += length;
+		if (*s == '\0')
+		{
+			return 0;
+		}
+		if (*s != ',')
+		{
+			return -1;
+		}
+	}
+}
+
+#define MAX_FIELDS 16 // largest number of fields per record of the record layout kernels
+
+// Kernel configuration selected at run time
+typedef struct
+{
+	int ndr, vec, block_x, block_y, interleave;
+	int cache;               // compiler-generated caches of global loads, disabled with NO_CACHE
+	int backend;
+	int simd, nt;            // SIMD code path and non-temporal stores of the CPU backend
+	numa_config_t numa;      // placement of host buffers and pinning of host threads
+	int alloc;               // allocation mode of host buffers
+	int locality;            // locality of the indexes of indirect kernels
+	int reads, writes;       // inputs and outputs of the generated RnWm kernel, -1 for the standard kernels
+	int dtype;               // element type of the buffers
+	int fields;              // fields per record of the record layout kernels, -1 for other families
+	int tile_size;           // elements per side of the local-memory tile of the transpose kernels, -1 for other families
+	int chan_depth;          // depth of the channels of channelized families in channel words, -1 for other families
+	int chan_width;          // elements per channel word of channelized families, -1 for other families
+	int fma_chain;           // FMAs per element implemented by the compute kernel of compute pipelines, built with FMAS; -1 for other families
+	int copies;              // copies of every kernel run concurrently, each in its own queues
+	int shared;              // all copies access the same buffers, otherwise every copy has its own
+	int banks[MAX_BUFFERS];  // memory bank of every buffer starting from 1 when interleaving is disabled, 0 to alternate banks 1 and 2
+	int devices;             // copies run one per device on consecutive devices starting from the selected one if more than one
+	cl_uint peer;            // device of the second kernel binary of multi-device families
+} bench_config_t;
+
+// Bytes per element of the buffers
+inline static long elem_size(const bench_config_t* config)
+{
+	return dtype_sizes[config->dtype];
+}
+
+// Checks that an array of array_size indexes is made of whole vectors and, for NDRange kernels with a fixed work-group size of wgs
+// work-items that have no bounds checks, of whole work-groups, so that the global size is a multiple of the work-group size
+inline static void check_work_groups(const bench_config_t* config, long array_size, int wgs)
+{
+	int multiple = config->vec * (config->ndr ? wgs : 1);
+	if (array_size % multiple != 0)
+	{
+		printf("Array size of %ld indexes must be a multiple of %d (vector size%s)!\n", array_size, multiple, config->ndr ? " times work-group size" : "");
+		exit(-1);
+	}
+}
+
+// Memory bank of a buffer starting from 1, only used when interleaving is disabled
+inline static int buffer_bank(const bench_config_t* config, int b)
+{
+	return (config->banks[b] > 0) ? config->banks[b] : b % 2 + 1;
+}
+
+// Run options shared by all families
+typedef struct
+{
+	int    iter;           // number of iterations
+	int    warmup;         // number of warm-up iterations excluded from statistics
+	int    iqr;            // outlier rejection
+	double ci;             // target 95% confidence interval in percent of the mean, disabled if zero
+	int    verbose, verify, profile;
+	int    format;         // output format of results
+	double fmax;           // operating frequency reported with every record, zero if unknown
+} bench_options_t;
+
+// Sizes of one sweep point with the derived kernel arguments and work sizes
+typedef struct
+{
+	int    pad, pad_x, pad_y, halo;
+	int    dim_x, dim_y, dim_z;
+	int    size_MiB;
+	int    size_KiB, chunk_KiB; // transfer and chunk size of transfers
+	int    stride;          // distance between consecutive accesses in vectors
+	int    window_KiB;      // window of the index locality of indirect kernels
+	int    reads, writes;   // buffers read and written per index by the read/write mix kernel
+	int    tile;            // records per tile of the AoSoA record layout
+	int    fmas;            // FMAs per element applied by the compute kernel of compute pipelines
+	long   size_B;
+	long   array_size;
+	long   padded_array_size;
+	long   last_x;          // end of the last block in x dimension
+	long   loop_exit;       // exit condition of single work-item kernels
+	long   groups, rows;    // vectors in the array and accesses per pass of strided kernels
+	long   accesses;        // indirect accesses or dependent loads per run
+	long   flops;           // floating-point operations per run of compute pipelines
+	long   total_B;         // bytes accessed per buffer including redundant accesses caused by halo
+	cl_uint dim;            // work dimensions of NDRange kernels
+	size_t localSize[3], globalSize[3];
+} point_t;
+
+// location of every swept parameter in point_t
+static const size_t param_offsets[NUM_PARAMS] = {offsetof(point_t, pad), offsetof(point_t, pad_x), offsetof(point_t, pad_y), offsetof(point_t, halo),
+                                                 offsetof(point_t, dim_z), offsetof(point_t, dim_y), offsetof(point_t, dim_x), offsetof(point_t, size_MiB),
+                                                 offsetof(point_t, chunk_KiB), offsetof(point_t, size_KiB), offsetof(point_t, stride),
+                                                 offsetof(point_t, window_KiB), offsetof(point_t, reads), offsetof(point_t, writes),
+                                                 offsetof(point_t, tile), offsetof(point_t, fmas)};
+
+typedef struct bench_s bench_t;
+typedef struct bench_kernel_s bench_kernel_t;
+
+// Descriptor of a kernel family; the runner does everything else
+typedef struct
+{
+	const char* name;                 // same as the make target and the kernel file suffix
+	const char* description;
+	int dims;                         // number of dimensions of the input
+	int blocked;                      // number of blocked dimensions, block sizes are not used if zero
+	int channelized;                  // separate read and write kernels connected by channels, each run in its own queue
+	int compute;                      // a compute kernel named "<kernel>_compute", without buffers, runs between the read and write
+	                                  // kernels of a channelized family in a queue of its own
+	int devices;                      // number of devices, each with its own kernel binary named "*_FPGA_<device number>.aocx"
+	int spread;                       // minimum number of devices that run one copy each, with -devices as default; zero if unused
+	int channel;                      // reports the bandwidth of the channel between devices; memory traffic is twice as much
+	const char* topology;             // links between the devices of the channel, NULL if the kernels do not use one
+	int wgs;                          // required work-group size of NDRange kernels, block_x / vec if zero
+	int cpu;                          // the CPU backend implements the traversal of the family
+	int single;                       // only single work-item kernels are implemented
+	int latency;                      // loads are dependent and their latency is reported instead of bandwidth
+	int rw;                           // the kernel file generates an RnWm kernel instead of the standard kernels with READS and WRITES
+	int typed;                        // the kernel file is built for any element type with DTYPE, otherwise only for float
+	int fields;                       // default number of fields per record of the kernel file, built with FIELDS; zero if unused
+	int tile_size;                    // default elements per side of the local-memory tile of the kernel file, built with TILE, which
+	                                  // replaces the block size as traversal unit and work-group size; zero if unused
+	int transfer;                     // kernels are transfers between host and device buffers, without kernel objects; their
+	                                  // device-side outputs are in buffer C and their host-side outputs in buffer D
+	int size_args[2];                 // number of arguments following the buffers for single work-item and NDRange kernels
+	unsigned params;                  // mask of supported swept parameters
+	int defaults[NUM_PARAMS];         // default values of the swept parameters
+	const char* sweeps[NUM_PARAMS];   // default sweeps of parameters that are swept even if not given, used instead of "defaults"
+	const kernel_desc_t* kernels;
+	int num_kernels;
+	void (*setup_point)(const bench_config_t* config, point_t* p); // computes sizes, arguments and work sizes from the swept parameters
+	void (*set_args)(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p); // sets the arguments following the buffers
+	long (*index)(const point_t* p, long i); // maps the i-th index of the input to its location in the padded buffers
+	int  (*run)(const bench_t* bench, const bench_kernel_t* kernel, const point_t* p, cl_event* event); // runs a kernel instead of the runner
+	                                  // and returns the number of events that span its device-side run time; NULL for OpenCL kernels
+	const char* index_buffers;        // buffers that hold indexes of indirect kernels, NULL if none; they are filled with int values
+	void (*fill_indexes)(const bench_config_t* config, const point_t* p, int* index, int buffer); // fills an index buffer for a sweep point
+	int  (*verify)(const bench_t* bench, const kernel_desc_t* desc, const point_t* p, void* const* host, int verbose); // checks the outputs
+	                                  // of a kernel instead of the runner, returns 1 if all indexes match; NULL for VERIFY_COPY/VERIFY_SUM
+} family_t;
+
+// OpenCL objects of a family; queue[0] runs the read kernel, or the only kernel of non-channelized families, the last queue of a copy
+// the write kernel and queue[1] the compute kernel in between, if the family has one
+// Transfer families use both queues of the same device for concurrent transfers
+// Concurrent copies of the kernels run in the queues that follow, copy_queues per copy, on the selected device or one device each
+struct bench_s
+{
+	const family_t*  family;
+	bench_config_t   config;
+	cl_context       context;
+	cl_device_id*    deviceList;
+	cl_uint          deviceCount;
+	cl_uint          deviceID;
+	cl_command_queue queue[MAX_QUEUES];
+	cl_uint          queue_device[MAX_QUEUES]; // index in deviceList of the device of every queue
+	int              num_queues;
+	int              copy_queues;
+};
+
+// Device and host copies of the buffers used by the kernels of a family, allocated once for the largest sweep point
+typedef struct
+{
+	int    used[MAX_BUFFERS];
+	int    input[MAX_BUFFERS]; // read by at least one kernel and filled with random data
+	int    output[MAX_BUFFERS]; // written by at least one kernel
+	int    count;
+	long   size_B;
+	void*  host[MAX_BUFFERS];
+	cl_mem device[MAX_BUFFERS];
+	cl_mem copy_device[MAX_COPIES - 1][MAX_BUFFERS]; // device buffers of the other concurrent copies, unless buffers are shared
+	cl_mem staging[MAX_BUFFERS]; // buffers allocated by the OpenCL runtime and mapped as host buffers in the ALLOC_CL_HOST mode
+	int    alloc;
+	double staging_time;         // time in ms to write all inputs to the device, zero on the CPU backend
+	long   staging_B;            // bytes written to the device
+	void*  reference;            // copy of the buffer of an in-place kernel taken before its runs, only allocated with --verify
+} buffer_set_t;
+
+// A kernel of the family with its kernel objects, or its buffers and traversal on the CPU backend, and timing results
+struct bench_kernel_s
+{
+	const kernel_desc_t* desc;
+	cl_kernel kernel[MAX_QUEUES];
+	cpu_op_t   op;
+	cpu_grid_t grid;
+	const buffer_set_t* set;  // buffers of the sweep point
+	samples_t samples;        // run time of all concurrent copies together
+	stats_t   host, device;
+	samples_t copy_samples[MAX_COPIES]; // device-side run time of every concurrent copy, only recorded with more than one
+	stats_t   copy_host[MAX_COPIES], copy_device[MAX_COPIES];
+	double    fairness;       // Jain's fairness index of the mean bandwidth of the copies, 1 if they all get the same
+};
+
+//====================================================================================================================================
+// Context and queue pool
+//====================================================================================================================================
+
+// Device that runs the kernel of the given queue; multi-device families run their second kernel on the peer device
+inline static cl_device_id bench_device(const bench_t* bench, int i)
+{
+	return bench->deviceList[bench->queue_device[i]];
+}
+
+// Program of the kernel of the given queue: multi-device families load one binary per device, and copies spread over devices one
+// program each
+inline static int queue_program(const bench_t* bench, int i)
+{
+	return (bench->config.devices > 1) ? i / bench->copy_queues : (bench->family->devices > 1) ? i : 0;
+}
+
+inline static void bench_init(bench_t* bench, const family_t* family, const bench_config_t* config, cl_uint deviceID)
+{
+	size_t deviceSize;
+	cl_int error;
+	cl_uint platformCount;
+	cl_platform_id* platforms = NULL;
+	cl_device_type   deviceType;
+	cl_context_properties ctxprop[3];
+
+	memset(bench, 0, sizeof(bench_t));
+	bench->family = family;
+	bench->config = *config;
+	bench->deviceID = deviceID;
+	bench->copy_queues = family->channelized ? 2 + family->compute : family->transfer ? 2 : 1;
+	bench->num_queues = bench->copy_queues * config->copies;
+
+	cl_uint last_device = deviceID;
+	for (int i = 0; i < bench->num_queues; i++)
+	{
+		bench->queue_device[i] = (config->devices > 1) ? deviceID + i / bench->copy_queues : (family->devices > 1 && i > 0) ? config->peer : deviceID;
+		last_device = (bench->queue_device[i] > last_device) ? bench->queue_device[i] : last_device;
+	}
+
+	numa_pin_threads(config->numa.cpu);
+
+	// the CPU backend needs no OpenCL objects
+	if (config->backend == BACKEND_CPU)
+	{
+		return;
+	}
+
+	display_device_info(&platforms, &platformCount);
+	select_device_type(&deviceType);
+	validate_selection(platforms, &platformCount, ctxprop, &deviceType, last_device);
+
+	// create OpenCL context
+	bench->context = clCreateContextFromType(ctxprop, deviceType, NULL, NULL, &error);
+	if(!bench->context)
+	{
+		printf("ERROR: clCreateContextFromType(%s) failed with error code: ", (deviceType == CL_DEVICE_TYPE_ACCELERATOR) ? "FPGA" : (deviceType == CL_DEVICE_TYPE_GPU) ? "GPU" : "CPU");
+		display_error_message(error, stdout);
+		exit(-1);
+	}
+
+	// get list of devices
+	CL_SAFE_CALL( clGetContextInfo(bench->context, CL_CONTEXT_DEVICES, 0, NULL, &deviceSize) );
+	bench->deviceCount = deviceSize / sizeof(cl_device_id);
+	if(bench->deviceCount < 1 || last_device >= bench->deviceCount)
+	{
+		printf("ERROR: No devices found.\n");
+		exit(-1);
+	}
+
+	// allocate memory for devices
+	bench->deviceList = (cl_device_id*)malloc(sizeof(cl_device_id) * bench->deviceCount);
+	if(!bench->deviceList)
+	{
+		printf("ERROR: malloc(deviceList) failed.\n");
+		exit(-1);
+	}
+
+	CL_SAFE_CALL( clGetContextInfo(bench->context, CL_CONTEXT_DEVICES, deviceSize, bench->deviceList, NULL) );
+
+	// create command queues, one per kernel of channelized families and per concurrent copy
+	for (int i = 0; i < bench->num_queues; i++)
+	{
+		bench->queue[i] = clCreateCommandQueue(bench->context, bench_device(bench, i), CL_QUEUE_PROFILING_ENABLE, &error);
+		if(!bench->queue[i])
+		{
+			printf("ERROR: clCreateCommandQueue(queue[%d]) failed with error code: ", i);
+			display_error_message(error, stdout);
+			exit(-1);
+		}
+	}
+
+	free(platforms); // platforms isn't needed anymore
+}
+
+inline static void bench_release(bench_t* bench)
+{
+	if (bench->config.backend == BACKEND_CPU)
+	{
+		return;
+	}
+
+	for (int i = 0; i < bench->num_queues; i++)
+	{
+		clReleaseCommandQueue(bench->queue[i]);
+	}
+	clReleaseContext(bench->context);
+	free(bench->deviceList);
+}
+
+//====================================================================================================================================
+// Buffer set
+//====================================================================================================================================
+
+// Traversal of the CPU backend for a sweep point
+inline static void set_cpu_grid(const bench_t* bench, const point_t* p, cpu_grid_t* g)
+{
+	int dims = bench->family->dims;
+
+	g->dims = dims;
+	g->dim_x = (dims == 1) ? p->array_size : p->dim_x;
+	g->dim_y = (dims >= 2) ? p->dim_y : 1;
+	g->dim_z = (dims == 3) ? p->dim_z : 1;
+	g->pad = p->pad;
+	g->pad_x = (dims >= 2) ? p->pad_x : 0;
+	g->pad_y = (dims == 3) ? p->pad_y : 0;
+	g->block_x = bench->config.block_x;
+	g->block_y = bench->config.block_y;
+	g->halo = p->halo;
+}
+
+// Device buffers of a concurrent copy of the kernels; all copies use those of the first one if buffers are shared
+inline static cl_mem* copy_buffers(const bench_t* bench, buffer_set_t* set, int copy)
+{
+	return (copy == 0 || bench->config.shared) ? set->device : set->copy_device[copy - 1];
+}
+
+// Whether a buffer has a device copy; the host-side source and destination of transfers, A and D, only exist on the host
+inline static int device_buffer(const family_t* family, int b)
+{
+	return !(family->transfer && (b == 0 || b == 3));
+}
+
+// Writes the banks of the device buffers as "A=1,B=2,...", or an empty string if buffers are interleaved; "text" must hold
+// MAX_BUFFERS * 4 characters
+inline static const char* format_banks(const bench_t* bench, const buffer_set_t* set, char* text)
+{
+	char* end = text;
+
+	*end = '\0';
+	for (int b = 0; b < MAX_BUFFERS && !bench->config.interleave; b++)
+	{
+		if (!set->used[b] || !device_buffer(bench->family, b)) continue;
+
+		end += sprintf(end, "%s%c=%d", (end == text) ? "" : ",", 'A' + b, buffer_bank(&bench->config, b));
+	}
+	return text;
+}
+
+// Creates the device buffers in the memory banks of the configuration and writes the inputs to them; called again with other banks
+// after bench_release_device_buffers
+inline static void bench_place_buffers(const bench_t* bench, buffer_set_t* set, int verbose)
+{
+	const family_t* family = bench->family;
+	long size_B = set->size_B;
+	cl_int error;
+
+	for (int b = 0; b < MAX_BUFFERS; b++)
+	{
+		if (bench->config.banks[b] > 0 && !set->used[b])
+		{
+			printf("Buffer %c is not used by kernel type \"%s\"!\n", 'A' + b, family->name);
+			exit(-1);
+		}
+	}
+
+	// create device buffers, one set per concurrent copy unless they are shared; their access flags follow from how the kernels
+	// use them
+	if (verbose) printf("Creating device buffers...\n");
+	int copies = bench->config.shared ? 1 : bench->config.copies;
+	for (int c = 0; c < copies; c++)
+	{
+		cl_mem* device = copy_buffers(bench, set, c);
+		for (int b = 0; b < MAX_BUFFERS; b++)
+		{
+			if (!set->used[b] || !device_buffer(family, b)) continue;
+
+			cl_mem_flags bank = bench->config.interleave ? 0 : buffer_banks[buffer_bank(&bench->config, b) - 1];
+
+			cl_mem_flags flags = (!set->output[b]) ? CL_MEM_READ_ONLY : (!set->input[b]) ? CL_MEM_WRITE_ONLY : CL_MEM_READ_WRITE;
+			device[b] = clCreateBuffer(bench->context, flags | bank, size_B, NULL, &error);
+			if(error != CL_SUCCESS) { printf("ERROR: clCreateBuffer device%c (size: %ld MiB) failed with error: ", 'A' + b, size_B / (1024 * 1024)); display_error_message(error, stdout); exit(-1);}
+		}
+	}
+
+	// write buffers, the same data to every copy through its own queue, which is on its device; the time it takes depends on how the
+	// host buffers are allocated
+	if (verbose) printf("Writing data to device...\n");
+	TimeStamp start, end;
+	set->staging_B = 0;
+	GetTime(start);
+	for (int c = 0; c < copies; c++)
+	{
+		cl_mem* device = copy_buffers(bench, set, c);
+		for (int b = 0; b < MAX_BUFFERS; b++)
+		{
+			if (!set->input[b] || !device_buffer(family, b)) continue;
+
+			CL_SAFE_CALL(clEnqueueWriteBuffer(bench->queue[c * bench->copy_queues], device[b], 1, 0, size_B, set->host[b], 0, 0, 0));
+			set->staging_B += size_B;
+		}
+	}
+	clFinish(bench->queue[0]);
+	GetTime(end);
+	set->staging_time = TimeDiff(start, end);
+}
+
+// Allocates the host and device buffers used by the kernels of the family for the given sweep point, normally the largest one,
+// and fills the inputs with random data
+// Host buffers follow the NUMA placement of the configuration; otherwise their pages are placed by the first thread that touches
+// them, which on the CPU backend is the thread that accesses them in the kernels
+inline static void bench_create_buffers(const bench_t* bench, buffer_set_t* set, const point_t* p, int verbose)
+{
+	const family_t* family = bench->family;
+	int dtype = bench->config.dtype;
+	long size_B = p->padded_array_size * elem_size(&bench->config);
+	cl_int error;
+
+	// index buffers hold int values, which can be wider than the elements
+	if (family->index_buffers != NULL && size_B < p->padded_array_size * (long)sizeof(int))
+	{
+		size_B = p->padded_array_size * sizeof(int);
+	}
+
+	memset(set, 0, sizeof(buffer_set_t));
+	set->size_B = size_B;
+	set->alloc = bench->config.alloc;
+	for (int k = 0; k < family->num_kernels; k++)
+	{
+		for (const char* b = family->kernels[k].buffers; *b != '\0'; b++)
+		{
+			set->used[*b - 'A'] = 1;
+		}
+		for (const char* b = family->kernels[k].read_buffers; *b != '\0'; b++)
+		{
+			set->input[*b - 'A'] = 1;
+		}
+		for (const char* b = family->kernels[k].write_buffers; *b != '\0'; b++)
+		{
+			set->output[*b - 'A'] = 1;
+		}
+	}
+
+	// create host buffers
+	if (verbose) printf("Creating host buffers...\n");
+	for (int b = 0; b < MAX_BUFFERS; b++)
+	{
+		set->count += set->used[b];
+		if (!set->used[b]) continue;
+
+		if (set->alloc == ALLOC_CL_HOST)
+		{
+			set->staging[b] = clCreateBuffer(bench->context, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, size_B, NULL, &error);
+			if(error != CL_SUCCESS) { printf("ERROR: clCreateBuffer staging%c (size: %ld MiB) failed with error: ", 'A' + b, size_B / (1024 * 1024)); display_error_message(error, stdout); exit(-1);}
+			set->host[b] = clEnqueueMapBuffer(bench->queue[0], set->staging[b], CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0, size_B, 0, NULL, NULL, &error);
+			if(error != CL_SUCCESS) { printf("ERROR: clEnqueueMapBuffer staging%c failed with error: ", 'A' + b); display_error_message(error, stdout); exit(-1);}
+		}
+		else
+		{
+			set->host[b] = host_alloc(size_B, set->alloc, bench->config.numa.mem);
+		}
+	}
+
+	// first touch on the CPU backend follows the distribution of the traversal among the threads
+	if (bench->config.backend == BACKEND_CPU)
+	{
+		cpu_grid_t grid;
+		cpu_op_t touch;
+		set_cpu_grid(bench, p, &grid);
+		memset(&touch, 0, sizeof(cpu_op_t));
+		touch.num_outputs = 1;
+		for (int b = 0; b < MAX_BUFFERS; b++)
+		{
+			if (!set->used[b]) continue;
+			touch.out[0] = set->host[b];
+			cpu_run(&grid, &touch, SIMD_SCALAR, 0);
+		}
+	}
+
+	// populate host buffers; outputs are only written by the kernels
+	if (verbose) printf("Filling host buffers with random data...\n");
+	long scalars = size_B / dtype_sizes[dtype] * dtype_lanes[dtype];
+	#pragma omp parallel default(none) firstprivate(scalars, dtype) shared(set)
+	{
+		uint seed = omp_get_thread_num();
+		for (int b = 0; b < MAX_BUFFERS; b++)
+		{
+			if (!set->input[b]) continue;
+
+			#pragma omp for
+			for (long i = 0; i < scalars; i++)
+			{
+				// generate random numbers of the element type; padding is also filled since it moves between sweep points
+				dtype_set(set->host[b], dtype, i, dtype_random(dtype, &seed));
+			}
+		}
+	}
+
+	// the CPU backend runs on the host buffers
+	if (bench->config.backend == BACKEND_CPU)
+	{
+		return;
+	}
+
+	bench_place_buffers(bench, set, verbose);
+}
+
+// Reads the given buffers of a concurrent copy back to the host from the queue of its last kernel
+inline static void bench_read_buffers(const bench_t* bench, buffer_set_t* set, int copy, const char* buffers, long size_B)
+{
+	cl_command_queue queue = bench->queue[(copy + 1) * bench->copy_queues - 1];
+	cl_mem* device = copy_buffers(bench, set, copy);
+
+	for (const char* b = buffers; *b != '\0'; b++)
+	{
+		CL_SAFE_CALL(clEnqueueReadBuffer(queue, device[*b - 'A'], 1, 0, size_B, set->host[*b - 'A'], 0, 0, 0));
+	}
+	clFinish(queue);
+}
+
+// Fills the index buffers of indirect kernels for a sweep point and writes them to the device
+inline static void bench_fill_indexes(const bench_t* bench, buffer_set_t* set, const point_t* p, int verbose)
+{
+	const family_t* family = bench->family;
+
+	if (family->index_buffers == NULL)
+	{
+		return;
+	}
+
+	if (verbose) printf("Generating %s indexes...\n", locality_names[bench->config.locality]);
+	for (const char* b = family->index_buffers; *b != '\0'; b++)
+	{
+		family->fill_indexes(&bench->config, p, (int*)set->host[*b - 'A'], *b - 'A');
+		for (int c = 0; c < (bench->config.shared ? 1 : bench->config.copies) && bench->config.backend != BACKEND_CPU; c++)
+		{
+			CL_SAFE_CALL(clEnqueueWriteBuffer(bench->queue[c * bench->copy_queues], copy_buffers(bench, set, c)[*b - 'A'], 1, 0, p->array_size * sizeof(int), set->host[*b - 'A'], 0, 0, 0));
+		}
+	}
+	if (bench->config.backend != BACKEND_CPU) clFinish(bench->queue[0]);
+}
+
+inline static void bench_release_device_buffers(const bench_t* bench, buffer_set_t* set)
+{
+	(void) bench;
+
+	for (int b = 0; b < MAX_BUFFERS; b++)
+	{
+		if (set->device[b] != NULL) clReleaseMemObject(set->device[b]);
+		set->device[b] = NULL;
+		for (int c = 0; c < MAX_COPIES - 1; c++)
+		{
+			if (set->copy_device[c][b] != NULL) clReleaseMemObject(set->copy_device[c][b]);
+			set->copy_device[c][b] = NULL;
+		}
+	}
+}
+
+inline static void bench_release_buffers(const bench_t* bench, buffer_set_t* set)
+{
+	bench_release_device_buffers(bench, set);
+	for (int b = 0; b < MAX_BUFFERS; b++)
+	{
+		if (!set->used[b]) continue;
+
+		if (set->staging[b] != NULL)
+		{
+			CL_SAFE_CALL(clEnqueueUnmapMemObject(bench->queue[0], set->staging[b], set->host[b], 0, NULL, NULL));
+			clFinish(bench->queue[0]);
+			clReleaseMemObject(set->staging[b]);
+		}
+		else
+		{
+			host_free(set->host[b], set->size_B, set->alloc);
+		}
+	}
+	free(set->reference);
+}
+
+//====================================================================================================================================
+// Kernel registry
+//====================================================================================================================================
+
+inline static cl_kernel create_kernel(cl_program prog, const char* name)
+{
+	cl_int error;
+	cl_kernel kernel = clCreateKernel(prog, name, &error);
+	if(error != CL_SUCCESS)
+	{
+		printf("ERROR: clCreateKernel(%s) failed with error: ", name);
+		display_error_message(error, stdout);
+		exit(-1);
+	}
+	return kernel;
+}
+
+// Checks that a kernel from the kernel binary matches the selected family, model, vector size and block size
+// The model is recognized from the number of arguments; vector and block size can only be checked for NDRange kernels that
+// have a required work-group size
+inline static void validate_kernel(const bench_t* bench, cl_kernel kernel, cl_device_id device, const char* name, const char* buffers, int sizes)
+{
+	const family_t* family = bench->family;
+	const bench_config_t* config = &bench->config;
+	cl_uint num_args;
+	size_t wgs[3];
+	cl_uint expected_args = strlen(buffers) + (sizes ? family->size_args[config->ndr] : 0);
+	int block = family->tile_size ? config->tile_size : config->block_x;
+	size_t expected_wgs = family->wgs ? (size_t)family->wgs : (size_t)(block / config->vec);
+
+	CL_SAFE_CALL( clGetKernelInfo(kernel, CL_KERNEL_NUM_ARGS, sizeof(cl_uint), &num_args, NULL) );
+	if (num_args != expected_args)
+	{
+		printf("Kernel \"%s\" has %u arguments instead of %u; kernel binary does not match kernel type \"%s\" and model \"%s\"!\n", name, num_args, expected_args, family->name, config->ndr ? "NDR" : "SWI");
+		exit(-1);
+	}
+
+	CL_SAFE_CALL( clGetKernelWorkGroupInfo(kernel, device, CL_KERNEL_COMPILE_WORK_GROUP_SIZE, sizeof(wgs), wgs, NULL) );
+	if (config->ndr && wgs[0] != 0 && wgs[0] != expected_wgs)
+	{
+		printf("Kernel \"%s\" requires a work-group size of %zu instead of %zu; kernel binary does not match vector size %d and block size %d!\n", name, wgs[0], expected_wgs, config->vec, block);
+		exit(-1);
+	}
+}
+
+// Checks that the local-memory tile of the family fits in the local memory of a device, and that its work-groups do not exceed the
+// largest work-group of the device; on Intel FPGAs, the tile is built into Block RAM by the offline compiler, which reports whether it
+// fits, and the local memory size of the runtime does not bound it
+inline static void validate_tile(const bench_t* bench, cl_device_id device)
+{
+	const bench_config_t* config = &bench->config;
+	size_t max_wgs;
+
+	if (!bench->family->tile_size)
+	{
+		return;
+	}
+
+#ifndef INTEL_FPGA
+	cl_ulong local_mem;
+	cl_ulong tile_B = (cl_ulong)config->tile_size * config->tile_size * elem_size(config);
+	CL_SAFE_CALL( clGetDeviceInfo(device, CL_DEVICE_LOCAL_MEM_SIZE, sizeof(cl_ulong), &local_mem, NULL) );
+	if (tile_B > local_mem)
+	{
+		printf("A tile of %dx%d elements needs %lu bytes of local memory, but the device only has %lu bytes!\n", config->tile_size, config->tile_size, (unsigned long)tile_B, (unsigned long)local_mem);
+		exit(-1);
+	}
+#endif
+
+	CL_SAFE_CALL( clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(size_t), &max_wgs, NULL) );
+	if (config->ndr && (size_t)(config->tile_size / config->vec) > max_wgs)
+	{
+		printf("A tile of %d elements needs work-groups of %d work-items, but the device supports at most %zu!\n", config->tile_size, config->tile_size / config->vec, max_wgs);
+		exit(-1);
+	}
+}
+
+// Loads the kernel binaries, one per device, or builds the kernel file of the family on other devices, then creates and validates
+// every kernel of the family
+inline static void bench_create_kernels(const bench_t* bench, const char* const* binaries, bench_kernel_t* kernels, int iter)
+{
+	const family_t* family = bench->family;
+	int num_programs = queue_program(bench, bench->num_queues - 1) + 1;
+	cl_program prog[MAX_QUEUES];
+	char* kernelSource;
+	size_t kernelFileSize;
+	cl_int error;
+
+	// the CPU backend and transfer families have no kernel objects
+	if (bench->config.backend == BACKEND_CPU || family->transfer)
+	{
+		for (int k = 0; k < family->num_kernels; k++)
+		{
+			memset(&kernels[k], 0, sizeof(bench_kernel_t));
+			kernels[k].desc = &family->kernels[k];
+			init_samples(&kernels[k].samples, iter);
+		}
+		return;
+	}
+
+	// device of every program, that of its first queue; copies spread over devices all load the binary of the first device
+	cl_device_id program_device[MAX_QUEUES];
+	for (int i = bench->num_queues - 1; i >= 0; i--)
+	{
+		program_device[queue_program(bench, i)] = bench_device(bench, i);
+	}
+
+#ifdef INTEL_FPGA
+	for (int i = 0; i < num_programs; i++)
+	{
+		const char* binary = binaries[(family->devices > 1) ? i : 0];
+		kernelSource = read_kernel(binary, &kernelFileSize);
+		prog[i] = clCreateProgramWithBinary(bench->context, 1, &program_device[i], &kernelFileSize, (const unsigned char**)&kernelSource, NULL, &error);
+		if(error != CL_SUCCESS)
+		{
+			printf("ERROR: clCreateProgramWithBinary(%s) failed with error: ", binary);
+			display_error_message(error, stdout);
+			exit(-1);
+		}
+		free(kernelSource);
+	}
+#else // for CPU/GPUs
+	char kernelFile[64];
+	(void) binaries;
+	sprintf(kernelFile, KERNEL_NAME "-%s.cl", family->name);
+	kernelSource = read_kernel(kernelFile, &kernelFileSize);
+
+	for (int i = 0; i < num_programs; i++)
+	{
+		prog[i] = clCreateProgramWithSource(bench->context, 1, (const char**)&kernelSource, NULL, &error);
+		if(error != CL_SUCCESS)
+		{
+			printf("ERROR: clCreateProgramWithSource() failed with error: ");
+			display_error_message(error, stdout);
+			exit(-1);
+		}
+	}
+	free(kernelSource);
+#endif
+
+	char clOptions[200] = "";
+
+#ifndef INTEL_FPGA
+	sprintf(clOptions + strlen(clOptions), "-DVEC=%d -DBLOCK_X=%d -DBLOCK_Y=%d ", bench->config.vec, bench->config.block_x, bench->config.block_y);
+
+	if (!bench->config.cache)
+	{
+		sprintf(clOptions + strlen(clOptions), "-DNO_CACHE ");
+	}
+
+	if (bench->config.dtype != DTYPE_FLOAT)
+	{
+		sprintf(clOptions + strlen(clOptions), "-DDTYPE=%s ", dtype_cl_names[bench->config.dtype]);
+	}
+
+	// the kernel file includes the generator of RnWm kernels from the working directory
+	if (bench->config.reads >= 0)
+	{
+		sprintf(clOptions + strlen(clOptions), "-DREADS=%d -DWRITES=%d -I. ", bench->config.reads, bench->config.writes);
+	}
+
+	if (bench->family->fields)
+	{
+		sprintf(clOptions + strlen(clOptions), "-DFIELDS=%d ", bench->config.fields);
+	}
+
+	if (bench->family->tile_size)
+	{
+		sprintf(clOptions + strlen(clOptions), "-DTILE=%d ", bench->config.tile_size);
+	}
+#endif
+
+	if (bench->config.ndr)
+	{
+		sprintf(clOptions + strlen(clOptions), "-DNDR");
+	}
+
+	// compile kernel file
+	for (int i = 0; i < num_programs; i++)
+	{
+		validate_tile(bench, program_device[i]);
+		clBuildProgram_SAFE(prog[i], 1, &program_device[i], clOptions, NULL, NULL);
+	}
+
+	// create kernel objects, one per concurrent copy since their buffers differ, and check them against the selected configuration
+	for (int k = 0; k < family->num_kernels; k++)
+	{
+		const kernel_desc_t* desc = &family->kernels[k];
+		memset(&kernels[k], 0, sizeof(bench_kernel_t));
+		kernels[k].desc = desc;
+		init_samples(&kernels[k].samples, iter);
+
+		for (int c = 0; c < bench->config.copies; c++)
+		{
+			int q = c * bench->copy_queues;
+			cl_kernel* kernel = &kernels[k].kernel[q];
+			if (family->channelized)
+			{
+				char name[32];
+				int w = bench->copy_queues - 1;
+				sprintf(name, "%s_read", desc->name);
+				kernel[0] = create_kernel(prog[queue_program(bench, q)], name);
+				validate_kernel(bench, kernel[0], bench_device(bench, q), name, desc->read_buffers, 1);
+				if (family->compute)
+				{
+					sprintf(name, "%s_compute", desc->name);
+					kernel[1] = create_kernel(prog[queue_program(bench, q + 1)], name);
+					validate_kernel(bench, kernel[1], bench_device(bench, q + 1), name, "", 1);
+				}
+				sprintf(name, "%s_write", desc->name);
+				kernel[w] = create_kernel(prog[queue_program(bench, q + w)], name);
+				validate_kernel(bench, kernel[w], bench_device(bench, q + w), name, desc->write_buffers, desc->write_sizes);
+			}
+			else
+			{
+				kernel[0] = create_kernel(prog[queue_program(bench, q)], desc->name);
+				validate_kernel(bench, kernel[0], bench_device(bench, q), desc->name, desc->buffers, 1);
+			}
+			if (bench->config.copies > 1) init_samples(&kernels[k].copy_samples[c], iter);
+		}
+	}
+
+	for (int i = 0; i < num_programs; i++)
+	{
+		clReleaseProgram(prog[i]);
+	}
+}
+
+inline static void bench_release_kernels(const bench_t* bench, bench_kernel_t* kernels)
+{
+	for (int k = 0; k < bench->family->num_kernels; k++)
+	{
+		for (int i = 0; i < bench->num_queues; i++)
+		{
+			if (kernels[k].kernel[i] != NULL) clReleaseKernel(kernels[k].kernel[i]);
+		}
+		free_samples(&kernels[k].samples);
+		for (int c = 0; c < bench->config.copies && bench->config.copies > 1; c++)
+		{
+			free_samples(&kernels[k].copy_samples[c]);
+		}
+	}
+}
+
+// Sets the buffer arguments of a kernel from the given device buffers, followed by the size arguments of the family if "sizes" is set
+inline static void set_kernel_args(const bench_t* bench, cl_kernel kernel, const char* buffers, int sizes, const cl_mem* device, const point_t* p)
+{
+	cl_uint arg = 0;
+
+	for (const char* b = buffers; *b != '\0'; b++)
+	{
+		CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_mem  ), (void*) &device[*b - 'A']) );
+	}
+	if (sizes)
+	{
+		bench->family->set_args(kernel, arg, &bench->config, p);
+	}
+}
+
+// Sets up the buffers and traversal of a kernel on the CPU backend; the number of buffers written per run follows from the bytes
+// transferred, kernels that write none only read their inputs
+inline static void set_cpu_args(const bench_t* bench, bench_kernel_t* kernel, const buffer_set_t* set, const point_t* p)
+{
+	const kernel_desc_t* desc = kernel->desc;
+	cpu_op_t* op = &kernel->op;
+
+	memset(op, 0, sizeof(cpu_op_t));
+	op->num_inputs = strlen(desc->read_buffers);
+	op->num_outputs = desc->bytes - op->num_inputs;
+	op->copy = (desc->verify != VERIFY_SUM);
+	op->inplace = desc->inplace;
+	for (int b = 0; b < op->num_inputs; b++)
+	{
+		op->in[b] = set->host[desc->read_buffers[b] - 'A'];
+	}
+	for (int b = 0; b < op->num_outputs; b++)
+	{
+		op->out[b] = set->host[desc->write_buffers[b] - 'A'];
+	}
+	op->sink = set->host[desc->write_buffers[0] - 'A'];
+
+	set_cpu_grid(bench, p, &kernel->grid);
+}
+
+// Sets the arguments of all kernels and their concurrent copies for a sweep point
+inline static void bench_set_args(const bench_t* bench, bench_kernel_t* kernels, buffer_set_t* set, const point_t* p)
+{
+	for (int k = 0; k < bench->family->num_kernels; k++)
+	{
+		const kernel_desc_t* desc = kernels[k].desc;
+		kernels[k].set = set;
+		if (bench->config.backend == BACKEND_CPU)
+		{
+			set_cpu_args(bench, &kernels[k], set, p);
+			continue;
+		}
+		else if (bench->family->transfer)
+		{
+			continue;
+		}
+
+		for (int c = 0; c < bench->config.copies; c++)
+		{
+			cl_kernel* kernel = &kernels[k].kernel[c * bench->copy_queues];
+			const cl_mem* device = copy_buffers(bench, set, c);
+			if (bench->family->channelized)
+			{
+				set_kernel_args(bench, kernel[0], desc->read_buffers , 1                , device, p);
+				if (bench->family->compute) set_kernel_args(bench, kernel[1], "", 1, device, p);
+				set_kernel_args(bench, kernel[bench->copy_queues - 1], desc->write_buffers, desc->write_sizes, device, p);
+			}
+			else
+			{
+				set_kernel_args(bench, kernel[0], desc->buffers, 1, device, p);
+			}
+		}
+	}
+}
+
+//====================================================================================================================================
+// Timed executor
+//====================================================================================================================================
+
+// Runs one kernel, or the read, compute and write kernels of channelized families concurrently, together with all concurrent
+// copies, and waits for completion; returns the number of events recorded, copy_queues per copy, zero on the CPU backend
+inline static int bench_run(const bench_t* bench, const bench_kernel_t* kernel, const point_t* p, cl_event* event)
+{
+	if (bench->config.backend == BACKEND_CPU)
+	{
+		cpu_run(&kernel->grid, &kernel->op, bench->config.simd, bench->config.nt);
+		return 0;
+	}
+	if (bench->family->run != NULL)
+	{
+		return bench->family->run(bench, kernel, p, event);
+	}
+
+	// copies spread over devices are run by one host thread per device, so that no device waits for the host to serve another one
+	int threads = (bench->config.devices > 1) ? bench->config.devices : 1;
+	#pragma omp parallel for num_threads(threads) schedule(static, 1)
+	for (int t = 0; t < threads; t++)
+	{
+		int first = t * bench->num_queues / threads, last = (t + 1) * bench->num_queues / threads;
+		for (int i = first; i < last; i++)
+		{
+			if (bench->config.ndr)
+			{
+				CL_SAFE_CALL( clEnqueueNDRangeKernel(bench->queue[i], kernel->kernel[i], p->dim, NULL, p->globalSize, p->localSize, 0, 0, (event == NULL) ? NULL : &event[i]) );
+			}
+			else
+			{
+				CL_SAFE_CALL( clEnqueueTask(bench->queue[i], kernel->kernel[i], 0, NULL, (event == NULL) ? NULL : &event[i]) );
+			}
+		}
+		for (int i = first; i < last; i++)
+		{
+			if ((i + 1) % bench->copy_queues == 0) clFinish(bench->queue[i]);
+		}
+	}
+	return bench->num_queues;
+}
+
+// Runs a kernel for the given number of iterations, or until the confidence interval of its run time is within the target,
+// recording the host wall time and device-side run time of every iteration; the CPU backend records its wall time as both
+inline static void bench_measure(const bench_t* bench, bench_kernel_t* kernel, const point_t* p, const bench_options_t* options)
+{
+	TimeStamp start, end;
+	double hostTime, deviceTime;
+	cl_event event[MAX_EVENTS];
+	samples_t* samples = &kernel->samples;
+
+	if (options->verify || options->verbose) printf("Executing \"%s\" kernel...\n", kernel->desc->name);
+	for (int i = 0; i < options->iter && !samples_stable(options->profile ? samples->device : samples->host, samples->count, options->warmup, options->ci); i++)
+	{
+		GetTime(start);
+		int count = bench_run(bench, kernel, p, event);
+		GetTime(end);
+		hostTime = TimeDiff(start, end);
+		if (count > 0 && bench->config.copies > 1)
+		{
+			// every copy is timed by the span of its own events, and the run by the span of all of them; devices have clocks of their
+			// own, so copies spread over devices are timed by the slowest one instead
+			cl_ulong first_start = 0, last_end = 0;
+			double slowest = 0;
+			for (int c = 0; c < bench->config.copies; c++)
+			{
+				cl_ulong copy_start, copy_end;
+				get_event_span(&event[c * bench->copy_queues], bench->copy_queues, &copy_start, &copy_end);
+				add_sample(&kernel->copy_samples[c], hostTime, (double)(copy_end - copy_start) / 1000000.0);
+				first_start = (c == 0 || copy_start < first_start) ? copy_start : first_start;
+				last_end = (c == 0 || copy_end > last_end) ? copy_end : last_end;
+				slowest = ((double)(copy_end - copy_start) / 1000000.0 > slowest) ? (double)(copy_end - copy_start) / 1000000.0 : slowest;
+			}
+			deviceTime = (bench->config.devices > 1) ? slowest : (double)(last_end - first_start) / 1000000.0;
+		}
+		else
+		{
+			deviceTime = (count == 0) ? hostTime : get_event_time(event, count);
+		}
+		if (options->profile) printf("%s iteration %d: host %.3f ms, device %.3f ms\n", kernel->desc->name, i + 1, hostTime, deviceTime);
+		add_sample(samples, hostTime, deviceTime);
+	}
+}
+
+//====================================================================================================================================
+// Verifier
+//====================================================================================================================================
+
+// Copies the buffer of an in-place kernel to the reference before its runs, from the device or from the host buffer on the CPU
+// backend
+inline static void bench_snapshot(const bench_t* bench, const bench_kernel_t* kernel, buffer_set_t* set, const point_t* p)
+{
+	int b = kernel->desc->write_buffers[0] - 'A';
+	long size_B = p->padded_array_size * elem_size(&bench->config);
+
+	if (set->reference == NULL)
+	{
+		set->reference = malloc(set->size_B);
+		if (set->reference == NULL)
+		{
+			printf("ERROR: malloc(reference) failed.\n");
+			exit(-1);
+		}
+	}
+
+	if (bench->config.backend == BACKEND_CPU)
+	{
+		memcpy(set->reference, set->host[b], size_B);
+	}
+	else
+	{
+		CL_SAFE_CALL(clEnqueueReadBuffer(bench->queue[0], set->device[b], 1, 0, size_B, set->reference, 0, 0, 0));
+	}
+}
+
+// Checks the buffer of an in-place kernel against the reference with FILL_VALUE added once per run; the additions are repeated
+// rather than multiplied so that the expected values are rounded exactly as on the device
+inline static int verify_inplace(const bench_t* bench, const bench_kernel_t* kernel, const buffer_set_t* set, const point_t* p, int verbose)
+{
+	long (*index_of)(const point_t*, long) = bench->family->index;
+	char output = kernel->desc->write_buffers[0];
+	const void* out = set->host[output - 'A'];
+	const void* reference = set->reference;
+	int dtype = bench->config.dtype, lanes = dtype_lanes[dtype];
+	int runs = kernel->samples.count;
+	int success = 1;
+
+	#pragma omp parallel for default(none) firstprivate(index_of, p, output, out, reference, dtype, lanes, runs, verbose) shared(success)
+	for (long i = 0; i < p->array_size; i++)
+	{
+		long index = index_of(p, i);
+
+		for (long s = index * lanes; s < (index + 1) * lanes; s++)
+		{
+			double expected = dtype_get(reference, dtype, s);
+			double obtained = dtype_get(out, dtype, s);
+
+			for (int r = 0; r < runs; r++)
+			{
+				expected = dtype_round(dtype, expected + FILL_VALUE);
+			}
+
+			if (obtained != expected)
+			{
+				if (verbose) printf("Mismatch at index %ld of buffer %c: Expected = %0.6f, Obtained = %0.6f\n", index, output, expected, obtained);
+				success = 0;
+			}
+		}
+	}
+
+	return success;
+}
+
+// Compares the outputs of a kernel read back to the host with the expected values, returns 1 if all indexes match
+inline static int verify_outputs(const bench_t* bench, const kernel_desc_t* desc, const point_t* p, void* const* host, int verbose)
+{
+	long (*index_of)(const point_t*, long) = bench->family->index;
+	const char* inputs = desc->read_buffers;
+	const char* outputs = desc->write_buffers;
+	int num_inputs = strlen(inputs), num_outputs = strlen(outputs);
+	int dtype = bench->config.dtype, lanes = dtype_lanes[dtype];
+	int verify = desc->verify;
+	int success = 1;
+
+	#pragma omp parallel for default(none) firstprivate(index_of, p, host, inputs, outputs, num_inputs, num_outputs, dtype, lanes, verify, verbose) shared(success)
+	for (long i = 0; i < p->array_size; i++)
+	{
+		long index = index_of(p, i);
+
+		for (long s = index * lanes; s < (index + 1) * lanes; s++)
+		{
+			for (int j = 0; j < num_outputs; j++)
+			{
+				double out = dtype_get(host[outputs[j] - 'A'], dtype, s);
+				double expected = 0;
+
+				if (verify == VERIFY_COPY)
+				{
+					expected = dtype_get(host[inputs[j] - 'A'], dtype, s);
+				}
+				else if (verify == VERIFY_FILL)
+				{
+					expected = FILL_VALUE;
+				}
+				else
+				{
+					for (int b = 0; b < num_inputs; b++)
+					{
+						expected = dtype_round(dtype, expected + dtype_get(host[inputs[b] - 'A'], dtype, s));
+					}
+				}
+
+				if ((verify != VERIFY_SUM) ? (out != expected) : (fabs(out - expected) > 0.001))
+				{
+					if (verbose) printf("Mismatch at index %ld of buffer %c: Expected = %0.6f, Obtained = %0.6f\n", index, outputs[j], expected, out);
+					success = 0;
+				}
+			}
+		}
+	}
+
+	return success;
+}
+
+// Reads the outputs of a kernel back from the device and verifies them, separately for every concurrent copy with its own buffers
+inline static void bench_verify(const bench_t* bench, const bench_kernel_t* kernel, buffer_set_t* set, const point_t* p, int verbose)
+{
+	const kernel_desc_t* desc = kernel->desc;
+	int copies = bench->config.shared ? 1 : bench->config.copies;
+
+	if (desc->verify == VERIFY_NONE)
+	{
+		printf("No verification available for this kernel!\n");
+		return;
+	}
+
+	// copies that share the buffer of an in-place kernel add to it in no particular order, and their updates can be lost
+	if (desc->verify == VERIFY_INPLACE && bench->config.shared && bench->config.copies > 1)
+	{
+		printf("No verification available for in-place kernels on shared buffers!\n");
+		return;
+	}
+
+	for (int c = 0; c < copies; c++)
+	{
+		// read data back to host; the CPU backend writes the host buffers directly, and so do transfers to the host
+		if (bench->config.backend != BACKEND_CPU)
+		{
+			printf("Reading data back from device...\n");
+			bench_read_buffers(bench, set, c, (!bench->family->transfer) ? desc->write_buffers : (strchr(desc->write_buffers, 'C') != NULL) ? "C" : "", p->padded_array_size * elem_size(&bench->config));
+		}
+
+		if (copies > 1) printf("Verifying \"%s\" kernel, copy %d: ", desc->name, c); else printf("Verifying \"%s\" kernel: ", desc->name);
+		if ((desc->verify == VERIFY_INPLACE) ? verify_inplace(bench, kernel, set, p, verbose) : (bench->family->verify != NULL) ? bench->family->verify(bench, desc, p, set->host, verbose) : verify_outputs(bench, desc, p, set->host, verbose))
+		{
+			printf("SUCCESS!\n");
+		}
+		else
+		{
+			printf("FAILURE!\n");
+		}
+	}
+}
+
+//====================================================================================================================================
+// Reporter
+//====================================================================================================================================
+
+// Bytes transferred by one run of a kernel; in-place kernels read their buffer including the halo, but write every index once
+inline static long kernel_bytes(const kernel_desc_t* desc, const point_t* p)
+{
+	int bytes = (desc->bytes > 0) ? desc->bytes : p->reads + p->writes;
+	return desc->inplace ? (bytes - 1) * p->total_B + p->size_B : bytes * p->total_B;
+}
+
+inline static void print_bandwidth(const char* name, long bytes, double time)
+{
+	printf("%s: %.3f GB/s (%.3f GiB/s) @%.1f ms\n", name, (double)bytes / (1.0E6 * time), (double)(bytes * 1000.0) / (pow(1024.0, 3) * time), time);
+}
+
+// Indirect kernels also report their access rate, one access per index
+inline static void print_indirect(const char* name, long bytes, long accesses, double time)
+{
+	printf("%s: %.3f GB/s (%.3f GiB/s) @%.1f ms, %.3f Gaccesses/s\n", name, (double)bytes / (1.0E6 * time), (double)(bytes * 1000.0) / (pow(1024.0, 3) * time), time, (double)accesses / (1.0E6 * time));
+}
+
+// Compute pipelines also report their FLOP rate, and the rate at which the compute kernel would run if it accepted a vector every
+// cycle at the operating frequency, if known, which is the compute roof of the chain
+inline static void print_compute(const char* name, long bytes, long flops, double time, long flops_per_cycle, double fmax)
+{
+	printf("%s: %.3f GB/s (%.3f GiB/s) @%.1f ms, %.3f GFLOP/s", name, (double)bytes / (1.0E6 * time), (double)(bytes * 1000.0) / (pow(1024.0, 3) * time), time, (double)flops / (1.0E6 * time));
+	if (fmax > 0) printf(" (roof %.3f GFLOP/s @%.2f MHz)", (double)flops_per_cycle * fmax / 1000.0, fmax);
+	printf("\n");
+}
+
+// Transfers also report their latency, which dominates small transfers
+inline static void print_transfer(const char* name, long bytes, double time)
+{
+	printf("%-7s: %.3f GB/s (%.3f GiB/s), latency %.1f us\n", name, (double)bytes / (1.0E6 * time), (double)(bytes * 1000.0) / (pow(1024.0, 3) * time), time * 1000.0);
+}
+
+// Dependent loads, or messages between devices, are reported as latency per access, and in cycles if the operating frequency is known
+inline static void print_latency(const char* name, const char* unit, long loads, double time, double fmax)
+{
+	double ns = time * 1.0E6 / (double)loads;
+	printf("%s: %.1f ns/%s", name, ns, unit);
+	if (fmax > 0) printf(", %.1f cycles/%s @%.2f MHz", ns * fmax / 1000.0, unit, fmax);
+	printf(" (%ld %ss @%.1f ms)\n", loads, unit, time);
+}
+
+// Prints the configuration of a sweep point in text mode
+inline static void bench_print_point(const bench_t* bench, const point_t* p, const buffer_set_t* set)
+{
+	const family_t* family = bench->family;
+	const bench_config_t* config = &bench->config;
+	int dims = family->dims;
+
+	printf("Kernel type:           %s\n", family->description);
+	if (config->backend == BACKEND_CPU)
+	{
+		printf("Kernel model:          CPU (%s%s, %d threads)\n", simd_names[config->simd], config->nt ? ", non-temporal stores" : "", omp_get_max_threads());
+	}
+	else if (!family->transfer)
+	{
+		printf("Kernel model:          %s\n", config->ndr ? "NDRange" : "Single Work-item");
+	}
+
+	if (family->latency && family->channelized)
+	{
+		printf("Message data:          %d KiB\n", p->size_KiB);
+		printf("Round trips:           %ld of %ld bytes\n", p->accesses / 2, config->vec / 2 * elem_size(config));
+	}
+	else if (family->latency)
+	{
+		printf("Working set:           %d KiB\n", p->size_KiB);
+		printf("Loads:                 %ld\n", p->accesses);
+	}
+	else if (family->transfer)
+	{
+		printf("Transfer size:         %d KiB\n", p->size_KiB);
+		if (p->chunk_KiB == 0 || (long)p->chunk_KiB * 1024 >= p->size_B) printf("Chunk size:            whole transfer\n"); else printf("Chunk size:            %d KiB\n", p->chunk_KiB);
+	}
+	else
+	{
+		if (dims >= 2) printf("X dimension size:      %d indexes\n", p->dim_x);
+		if (dims >= 2) printf("Y dimension size:      %d indexes\n", p->dim_y);
+		if (dims == 3) printf("Z dimension size:      %d indexes\n", p->dim_z);
+		printf("Array size:            %ld indexes\n", p->array_size);
+		printf("Buffer size:           %d MiB\n", p->size_MiB);
+		printf("Total memory usage:    %d MiB\n", set->count * p->size_MiB * (config->shared ? 1 : config->copies));
+	}
+
+	if (family->blocked)
+	{
+		printf("%s", config->ndr ? "Work-group\\Block size: " : "Block size:            ");
+		if (family->blocked == 2) printf("%dx%d\n", config->block_x, config->block_y); else printf("%d\n", config->block_x);
+	}
+
+	if (config->backend != BACKEND_CPU && !family->transfer && (!family->latency || family->channelized)) printf("Vector size:           %d\n", config->vec);
+	if (family->channelized) printf("Channel words:         %d deep, %d elements (%ld bytes) wide\n", config->chan_depth, config->chan_width, config->chan_width * elem_size(config));
+	if (config->dtype != DTYPE_FLOAT) printf("Element type:          %s (%ld bytes, %ld bytes per vector)\n", dtype_names[config->dtype], elem_size(config), config->vec * elem_size(config));
+	if (config->backend != BACKEND_CPU && ((family->latency && !family->channelized) || !config->cache)) printf("Load cache:            %s\n", config->cache ? "enabled" : "disabled (NO_CACHE)");
+	if (family->params & PARAM(PARAM_PAD)  ) printf("Array padding:         %d\n", p->pad);
+	if (family->params & PARAM(PARAM_PAD_X)) printf("Row padding:           %d\n", p->pad_x);
+	if (family->params & PARAM(PARAM_PAD_Y)) printf("Column padding:        %d\n", p->pad_y);
+	if (family->params & PARAM(PARAM_HALO) ) printf("Halo width:            %d\n", p->halo);
+	if (family->params & PARAM(PARAM_WINDOW))
+	{
+		if (config->locality == LOCALITY_BLOCK) printf("Index locality:        block-random in %d KiB windows\n", p->window_KiB);
+		else if (config->locality == LOCALITY_JITTER) printf("Index locality:        sorted with %d KiB jitter\n", p->window_KiB);
+		else printf("Index locality:        %s\n", locality_names[config->locality]);
+	}
+	if (family->params & PARAM(PARAM_STRIDE)) printf("Stride:                %d vectors (%ld bytes)\n", p->stride, (long)p->stride * config->vec * elem_size(config));
+	if (family->params & PARAM(PARAM_READS) ) printf("Reads:writes:          %d:%d per index\n", p->reads, p->writes);
+	if (family->tile_size) printf("Transpose tile:        %dx%d elements (%ld bytes of local memory)\n", config->tile_size, config->tile_size, (long)config->tile_size * config->tile_size * elem_size(config));
+	if (family->fields) printf("Record fields:         %d (%ld bytes per record)\n", config->fields, config->fields * elem_size(config));
+	if (family->params & PARAM(PARAM_TILE)  ) printf("AoSoA tile:            %d records\n", p->tile);
+	if (family->params & PARAM(PARAM_FMA)   ) printf("FMA chain:             %d of %d FMAs per element (%.3f FLOP/byte)\n", p->fmas, config->fma_chain, (double)p->flops / (2.0 * p->total_B));
+
+	if (config->devices > 1) printf("Devices:               %d (IDs %u to %u), one copy each\n", config->devices, bench->deviceID, bench->deviceID + config->devices - 1);
+	else if (config->copies > 1) printf("Concurrent copies:     %d on %s buffers\n", config->copies, config->shared ? "shared" : "disjoint");
+	if (family->devices > 1 && config->backend != BACKEND_CPU) printf("Devices:               %u to %u\n", bench->deviceID, config->peer);
+	if (!config->interleave)
+	{
+		char banks[MAX_BUFFERS * 4];
+		printf("Memory banks:          %s\n", format_banks(bench, set, banks));
+	}
+	if (config->alloc != ALLOC_HEAP) printf("Host allocation:       %s\n", alloc_names[config->alloc]);
+	if (config->backend != BACKEND_CPU)
+	{
+		printf("Staging (host to dev): %.3f GB/s (%.3f GiB/s) @%.1f ms\n", (double)set->staging_B / (1.0E6 * set->staging_time), (double)(set->staging_B * 1000.0) / (pow(1024.0, 3) * set->staging_time), set->staging_time);
+	}
+	if (config->numa.cpu != NUMA_LOCAL)
+	{
+		if (config->numa.cpu == NUMA_ALL) printf("Thread pinning:        all CPUs\n"); else printf("Thread pinning:        node %d\n", config->numa.cpu);
+	}
+	if (config->numa.mem != NUMA_LOCAL)
+	{
+		if (config->numa.mem == NUMA_INTERLEAVE) printf("Buffer placement:      interleaved\n"); else printf("Buffer placement:      node %d\n", config->numa.mem);
+	}
+	if (config->numa.cpu != NUMA_LOCAL || config->numa.mem != NUMA_LOCAL)
+	{
+		for (int b = 0; b < MAX_BUFFERS; b++)
+		{
+			if (set->used[b]) numa_print_placement('A' + b, set->host[b], set->size_B);
+		}
+	}
+	printf("\n");
+}
+
+// Computes bandwidth statistics of all kernels for a sweep point and prints them in the selected format
+inline static void bench_report(const bench_t* bench, bench_kernel_t* kernels, const point_t* p, const buffer_set_t* set, const bench_options_t* options)
+{
+	const family_t* family = bench->family;
+	const bench_config_t* config = &bench->config;
+	int copies = config->copies;
+
+	// concurrent copies are reported together, with the bytes of all of them, and one by one
+	for (int k = 0; k < family->num_kernels; k++)
+	{
+		long bytes = kernel_bytes(kernels[k].desc, p);
+		compute_stats(kernels[k].samples.host  , kernels[k].samples.count, copies * bytes, options->warmup, options->iqr, &kernels[k].host  );
+		compute_stats(kernels[k].samples.device, kernels[k].samples.count, copies * bytes, options->warmup, options->iqr, &kernels[k].device);
+
+		double sum = 0, sum_squares = 0;
+		for (int c = 0; c < copies && copies > 1; c++)
+		{
+			samples_t* samples = &kernels[k].copy_samples[c];
+			compute_stats(samples->host  , samples->count, bytes, options->warmup, options->iqr, &kernels[k].copy_host[c]  );
+			compute_stats(samples->device, samples->count, bytes, options->warmup, options->iqr, &kernels[k].copy_device[c]);
+			sum += kernels[k].copy_device[c].mean;
+			sum_squares += kernels[k].copy_device[c].mean * kernels[k].copy_device[c].mean;
+		}
+		kernels[k].fairness = (copies > 1 && sum_squares > 0) ? sum * sum / (copies * sum_squares) : 1;
+	}
+
+	if (options->format == FORMAT_TEXT)
+	{
+		for (int source = 0; source < (options->profile ? 2 : 1); source++)
+		{
+			if (source == 1) printf("\nDevice-side timing (OpenCL event profiling):\n");
+
+			if (family->channel)
+			{
+				double time = (source == 0) ? kernels[0].host.time : kernels[0].device.time;
+				print_bandwidth("Channel bandwidth", 1 * copies * kernel_bytes(kernels[0].desc, p), time);
+				print_bandwidth("Memory bandwidth ", 2 * copies * kernel_bytes(kernels[0].desc, p), time);
+				continue;
+			}
+
+			if (family->latency)
+			{
+				for (int k = 0; k < family->num_kernels; k++)
+				{
+					print_latency(kernels[k].desc->name, family->channelized ? "hop" : "load", p->accesses, (source == 0) ? kernels[k].host.time : kernels[k].device.time, options->fmax);
+				}
+				continue;
+			}
+
+			if (family->transfer)
+			{
+				for (int k = 0; k < family->num_kernels; k++)
+				{
+					print_transfer(kernels[k].desc->name, kernel_bytes(kernels[k].desc, p), (source == 0) ? kernels[k].host.time : kernels[k].device.time);
+				}
+				continue;
+			}
+
+			if (source == 0) printf("Redundancy: %.2f%%\n", ((float)(p->total_B - p->size_B) * 100.0)/(float)p->total_B);
+			for (int k = 0; k < family->num_kernels; k++)
+			{
+				if (family->compute)
+				{
+					print_compute(kernels[k].desc->name, copies * kernel_bytes(kernels[k].desc, p), copies * p->flops, (source == 0) ? kernels[k].host.time : kernels[k].device.time, 2L * copies * config->vec * p->fmas, options->fmax);
+					continue;
+				}
+				if (family->index_buffers != NULL)
+				{
+					print_indirect(kernels[k].desc->name, copies * kernel_bytes(kernels[k].desc, p), copies * p->accesses, (source == 0) ? kernels[k].host.time : kernels[k].device.time);
+					continue;
+				}
+				print_bandwidth(kernels[k].desc->name, copies * kernel_bytes(kernels[k].desc, p), (source == 0) ? kernels[k].host.time : kernels[k].device.time);
+			}
+		}
+
+		// copies are only timed on the device, where the span of every copy is known
+		if (copies > 1)
+		{
+			const char* unit = (config->devices > 1) ? "device" : "copy";
+			printf("\nPer-%s bandwidth (device-side timing):\n", unit);
+			for (int k = 0; k < family->num_kernels; k++)
+			{
+				double slowest = 0, fastest = 0;
+				for (int c = 0; c < copies; c++)
+				{
+					char name[40];
+					sprintf(name, "%s[%d]", kernels[k].desc->name, (config->devices > 1) ? (int)bench->queue_device[c * bench->copy_queues] : c);
+					print_bandwidth(name, kernel_bytes(kernels[k].desc, p), kernels[k].copy_device[c].time);
+					slowest = (c == 0 || kernels[k].copy_device[c].mean < slowest) ? kernels[k].copy_device[c].mean : slowest;
+					fastest = (c == 0 || kernels[k].copy_device[c].mean > fastest) ? kernels[k].copy_device[c].mean : fastest;
+				}
+				printf("%s fairness: %.4f (Jain's index), slowest %s at %.1f%% of the fastest\n", kernels[k].desc->name, kernels[k].fairness, unit, (fastest > 0) ? slowest * 100.0 / fastest : 0.0);
+			}
+		}
+
+		if (options->iter > 1)
+		{
+			for (int source = 0; source < (options->profile ? 2 : 1); source++)
+			{
+				if (family->channel)
+				{
+					print_stats_header((source == 0) ? "Channel bandwidth statistics (GB/s) based on host wall time:" : "Channel bandwidth statistics (GB/s) based on device-side timing:");
+				}
+				else
+				{
+					print_stats_header((source == 0) ? "Statistics (GB/s) based on host wall time:" : "Statistics (GB/s) based on device-side timing:");
+				}
+				for (int k = 0; k < family->num_kernels; k++)
+				{
+					print_stats(kernels[k].desc->name, (source == 0) ? &kernels[k].host : &kernels[k].device);
+				}
+			}
+		}
+		return;
+	}
+
+	config_t record;
+	char simd[32] = "", numa_mem[16], numa_cpu[16], banks[MAX_BUFFERS * 4];
+	memset(&record, 0, sizeof(config_t));
+	record.type = family->name;
+	record.model = (config->backend == BACKEND_CPU) ? "CPU" : config->ndr ? "NDR" : "SWI";
+	if (config->backend == BACKEND_CPU)
+	{
+		sprintf(simd, "%s%s", simd_names[config->simd], config->nt ? "_nt" : "");
+		record.simd = simd;
+		record.threads = omp_get_max_threads();
+	}
+	record.vec = config->vec;
+	record.dtype = dtype_names[config->dtype];
+	record.block_x = (family->blocked >= 1) ? config->block_x : family->tile_size ? config->tile_size : 0;
+	record.block_y = (family->blocked == 2) ? config->block_y : 0;
+	record.interleave = config->interleave;
+	record.cache = (config->backend == BACKEND_CPU) ? -1 : config->cache;
+	record.banks = config->interleave ? NULL : format_banks(bench, set, banks);
+	record.numa_mem = numa_name(config->numa.mem, numa_mem);
+	record.numa_cpu = (config->numa.cpu == NUMA_ALL) ? "all" : numa_name(config->numa.cpu, numa_cpu);
+	record.alloc = alloc_names[set->alloc];
+	record.staging_time = set->staging_time;
+	record.staging_B = set->staging_B;
+	record.fmax = options->fmax;
+	record.pad = p->pad;
+	record.pad_x = p->pad_x;
+	record.pad_y = p->pad_y;
+	record.halo = p->halo;
+	record.stride = p->stride;
+	record.reads = p->reads;
+	record.writes = p->writes;
+	record.tile = p->tile;
+	record.fmas = p->fmas;
+	record.locality = (family->params & PARAM(PARAM_WINDOW)) ? locality_names[config->locality] : NULL;
+	record.window_B = ((family->params & PARAM(PARAM_WINDOW)) && (config->locality == LOCALITY_BLOCK || config->locality == LOCALITY_JITTER)) ? (long)p->window_KiB * 1024 : 0;
+	record.accesses = p->accesses;
+	record.flops = p->flops;
+	record.latency = family->latency;
+	record.dim_x = (family->dims == 1) ? p->array_size : p->dim_x;
+	record.dim_y = (family->dims >= 2) ? p->dim_y : 1;
+	record.dim_z = (family->dims == 3) ? p->dim_z : 1;
+	record.size_B = p->size_B;
+	record.total_B = p->total_B;
+	record.warmup = options->warmup;
+	record.iqr = options->iqr;
+	record.copies = copies;
+	record.shared = config->shared;
+	record.devices = (config->devices > 1) ? config->devices : family->devices;
+	record.peer = (family->devices > 1 && config->backend != BACKEND_CPU) ? (int)config->peer : -1;
+	record.topology = family->topology;
+	record.chan_depth = family->channelized ? config->chan_depth : -1;
+	record.chan_width = family->channelized ? config->chan_width : -1;
+
+	for (int k = 0; k < family->num_kernels; k++)
+	{
+		record.copy = -1;
+		record.device = bench->deviceID;
+		record.fairness = kernels[k].fairness;
+		report_record(options->format, &record, kernels[k].desc->name, copies * kernel_bytes(kernels[k].desc, p), &kernels[k].samples, &kernels[k].host, &kernels[k].device);
+		for (int c = 0; c < copies && copies > 1; c++)
+		{
+			record.copy = c;
+			record.device = bench->queue_device[c * bench->copy_queues];
+			report_record(options->format, &record, kernels[k].desc->name, kernel_bytes(kernels[k].desc, p), &kernels[k].copy_samples[c], &kernels[k].copy_host[c], &kernels[k].copy_device[c]);
+		}
+	}
+}
+
+//====================================================================================================================================
+// Sweep driver
+//====================================================================================================================================
+
+// Sets up the swept parameters of a family from their command-line arguments, or the family defaults if not given
+inline static void bench_setup_sweeps(const family_t* family, sweep_t* sweeps, const char* const* args)
+{
+	for (int i = 0; i < NUM_PARAMS; i++)
+	{
+		if (args[i] != NULL && !(family->params & PARAM(i)))
+		{
+			printf("Option %s is not supported by kernel type \"%s\"!\n", param_options[i], family->name);
+			exit(-1);
+		}
+
+		if (args[i] != NULL)
+		{
+			sweep_parse(&sweeps[i], args[i]);
+		}
+		else if (family->sweeps[i] != NULL)
+		{
+			sweep_parse(&sweeps[i], family->sweeps[i]);
+		}
+		else
+		{
+			sweep_init(&sweeps[i], family->defaults[i]);
+		}
+	}
+}
+
+// Drops the transfer sizes of the default sweep of transfer families that do not fit the device, so that a run without -kib
+// measures every size the board can hold: each device buffer must fit in a single allocation and all of them in global memory
+// Sizes given with -kib are kept, so that they fail with the allocation error of the device
+inline static void bench_fit_sweeps(const bench_t* bench, sweep_t* sweeps, const char* const* args)
+{
+	const family_t* family = bench->family;
+	cl_ulong max_alloc, global_mem;
+	int used[MAX_BUFFERS] = {0}, buffers = 0;
+
+	if (!family->transfer || args[PARAM_KIB] != NULL)
+	{
+		return;
+	}
+
+	for (int k = 0; k < family->num_kernels; k++)
+	{
+		for (const char* b = family->kernels[k].buffers; *b != '\0'; b++)
+		{
+			used[*b - 'A'] = 1;
+		}
+	}
+	for (int b = 0; b < MAX_BUFFERS; b++)
+	{
+		buffers += used[b] && device_buffer(family, b);
+	}
+
+	CL_SAFE_CALL( clGetDeviceInfo(bench_device(bench, 0), CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(cl_ulong), &max_alloc, NULL) );
+	CL_SAFE_CALL( clGetDeviceInfo(bench_device(bench, 0), CL_DEVICE_GLOBAL_MEM_SIZE, sizeof(cl_ulong), &global_mem, NULL) );
+	cl_ulong limit_B = (global_mem / buffers < max_alloc) ? global_mem / buffers : max_alloc;
+
+	sweep_clamp(&sweeps[PARAM_KIB], (limit_B / 1024 > INT_MAX) ? INT_MAX : (int)(limit_B / 1024));
+	if (sweeps[PARAM_KIB].count == 0)
+	{
+		printf("No transfer size of the default sweep fits the %lu KiB of device memory, give one with -kib!\n", (unsigned long)(global_mem / 1024));
+		exit(-1);
+	}
+}
+
+inline static int bench_num_points(const sweep_t* sweeps)
+{
+	int num_points = 1;
+	for (int i = 0; i < NUM_PARAMS; i++)
+	{
+		num_points *= sweeps[i].count;
+	}
+	return num_points;
+}
+
+// Sets up the given sweep point, or the point with the largest value of every parameter if "point" is negative
+inline static void bench_get_point(const bench_t* bench, const sweep_t* sweeps, int point, point_t* p)
+{
+	memset(p, 0, sizeof(point_t));
+	for (int i = 0; i < NUM_PARAMS; i++)
+	{
+		int value = (point < 0) ? sweep_max(&sweeps[i]) : sweeps[i].values[point % sweeps[i].count];
+		*(int*)((char*)p + param_offsets[i]) = value;
+		if (point >= 0) point /= sweeps[i].count;
+	}
+	bench->family->setup_point(&bench->config, p);
+}
+
+// Runs every combination of swept parameters, reusing the OpenCL context, kernels and buffers
+inline static void bench_sweep(const bench_t* bench, bench_kernel_t* kernels, buffer_set_t* set, const sweep_t* sweeps, const bench_options_t* options)
+{
+	const family_t* family = bench->family;
+	int num_points = bench_num_points(sweeps);
+
+	for (int point = 0; point < num_points; point++)
+	{
+		point_t p;
+		bench_get_point(bench, sweeps, point, &p);
+
+		for (int k = 0; k < family->num_kernels; k++)
+		{
+			reset_samples(&kernels[k].samples);
+			for (int c = 0; c < bench->config.copies && bench->config.copies > 1; c++)
+			{
+				reset_samples(&kernels[k].copy_samples[c]);
+			}
+		}
+
+		if (options->format == FORMAT_TEXT)
+		{
+			if (point > 0) printf("\n");
+			bench_print_point(bench, &p, set);
+		}
+
+		bench_fill_indexes(bench, set, &p, options->verbose);
+		bench_set_args(bench, kernels, set, &p);
+
+		// device warm-up
+		if (options->verbose) printf("Device warm-up...\n");
+		bench_run(bench, &kernels[0], &p, NULL);
+
+		for (int k = 0; k < family->num_kernels; k++)
+		{
+			if (options->verify && kernels[k].desc->verify == VERIFY_INPLACE)
+			{
+				bench_snapshot(bench, &kernels[k], set, &p);
+			}
+			bench_measure(bench, &kernels[k], &p, options);
+			if (options->verify)
+			{
+				bench_verify(bench, &kernels[k], set, &p, options->verbose);
+			}
+		}
+
+		if (options->verify || options->verbose) printf("\n");
+
+		bench_report(bench, kernels, &p, set, options);
+	}
+}
+
+// Runs the sweep point with every placement of the device buffers in the given number of banks, recreating the buffers for each
+// one, and prints the best and worst placement of every kernel by its mean run time; buffers are placed in the order of their
+// letters, the first one changing fastest
+inline static void bench_sweep_banks(bench_t* bench, bench_kernel_t* kernels, buffer_set_t* set, const sweep_t* sweeps, const bench_options_t* options, int num_banks)
+{
+	const family_t* family = bench->family;
+	int placed[MAX_BUFFERS], count = 0;
+	long placements = 1;
+
+	for (int b = 0; b < MAX_BUFFERS; b++)
+	{
+		if (!set->used[b] || !device_buffer(family, b)) continue;
+
+		placed[count++] = b;
+		placements *= num_banks;
+		if (placements > MAX_PLACEMENTS)
+		{
+			printf("Kernel type \"%s\" has too many bank placements in %d banks, at most %d are run!\n", family->name, num_banks, MAX_PLACEMENTS);
+			exit(-1);
+		}
+	}
+
+	double best[MAX_KERNELS], worst[MAX_KERNELS];
+	long best_at[MAX_KERNELS], worst_at[MAX_KERNELS];
+	for (long i = 0; i < placements; i++)
+	{
+		for (int j = 0, code = i; j < count; j++, code /= num_banks)
+		{
+			bench->config.banks[placed[j]] = code % num_banks + 1;
+		}
+		bench_release_device_buffers(bench, set);
+		bench_place_buffers(bench, set, options->verbose);
+
+		if (options->format == FORMAT_TEXT && i > 0) printf("\n");
+		bench_sweep(bench, kernels, set, sweeps, options);
+
+		for (int k = 0; k < family->num_kernels; k++)
+		{
+			double time = options->profile ? kernels[k].device.time : kernels[k].host.time;
+			if (i == 0 || time < best[k] ) { best[k]  = time; best_at[k]  = i; }
+			if (i == 0 || time > worst[k]) { worst[k] = time; worst_at[k] = i; }
+		}
+	}
+
+	if (options->format != FORMAT_TEXT)
+	{
+		return;
+	}
+
+	point_t p;
+	bench_get_point(bench, sweeps, 0, &p);
+	printf("\nBank placements: %ld in %d banks, ranked by %s\n", placements, num_banks, options->profile ? "device-side timing" : "host wall time");
+	for (int k = 0; k < family->num_kernels; k++)
+	{
+		for (int worst_case = 0; worst_case < 2; worst_case++)
+		{
+			char name[MAX_BUFFERS * 4 + 40], banks[MAX_BUFFERS * 4];
+			for (int j = 0, code = worst_case ? worst_at[k] : best_at[k]; j < count; j++, code /= num_banks)
+			{
+				bench->config.banks[placed[j]] = code % num_banks + 1;
+			}
+			sprintf(name, "%s %s (%s)", kernels[k].desc->name, worst_case ? "worst" : "best ", format_banks(bench, set, banks));
+			print_bandwidth(name, bench->config.copies * kernel_bytes(kernels[k].desc, &p), worst_case ? worst[k] : best[k]);
+		}
+	}
+}
+
+#endif // BENCH_H
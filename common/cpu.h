@@ -0,0 +1,343 @@
+//====================================================================================================================================
+// Native CPU backend: OpenMP implementations of the kernels that follow the same blocked traversals, halo and padding as the
+// OpenCL kernels, with AVX2, AVX-512 and scalar code paths and optional non-temporal stores
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef CPU_H
+#define CPU_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <omp.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+	#define CPU_X86 // AVX2 and AVX-512 code is always compiled in and selected at run time
+#endif
+
+// SIMD code paths; non-temporal stores are only available with AVX2 and AVX-512
+enum {SIMD_SCALAR, SIMD_AVX2, SIMD_AVX512, NUM_SIMD};
+static const char* const simd_names[NUM_SIMD] = {"scalar", "avx2", "avx512"};
+
+#define FILL_VALUE 1.0f // written by kernels without inputs and added by in-place kernels, on every backend
+
+// Shape of a traversal in the index space of the kernels; unused dimensions are one and only 3D inputs are blocked in y dimension
+typedef struct
+{
+	int  dims;
+	long dim_x, dim_y, dim_z;
+	long pad, pad_x, pad_y;
+	int  block_x, block_y, halo;
+} cpu_grid_t;
+
+// Buffers of a kernel: every output is written with the sum of all inputs, or with the input in the same position if "copy" is
+// set, or with FILL_VALUE if there are no inputs; kernels without outputs only read their input and write its sum to "sink" to
+// prevent the accesses from being optimized out
+// In-place kernels add FILL_VALUE to their only output outside the halo and only read the halo
+typedef struct
+{
+	const float* in[3];
+	float*       out[2];
+	int          num_inputs, num_outputs;
+	int          copy;
+	int          inplace;
+	float*       sink;
+} cpu_op_t;
+
+// Returns the index of the given SIMD code path name, or -1 if unknown
+inline static int parse_simd(const char* name)
+{
+	for (int i = 0; i < NUM_SIMD; i++)
+	{
+		if (strcmp(name, simd_names[i]) == 0)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+inline static int cpu_simd_supported(int simd)
+{
+#ifdef CPU_X86
+	__builtin_cpu_init();
+	if (simd == SIMD_AVX512) return __builtin_cpu_supports("avx512f");
+	if (simd == SIMD_AVX2  ) return __builtin_cpu_supports("avx2");
+#endif
+	return simd == SIMD_SCALAR;
+}
+
+// Widest SIMD code path supported by the processor
+inline static int cpu_simd_best()
+{
+	int simd = NUM_SIMD - 1;
+	while (!cpu_simd_supported(simd))
+	{
+		simd--;
+	}
+	return simd;
+}
+
+//====================================================================================================================================
+// Span kernels, each runs over "n" consecutive indexes of one row of a block
+//====================================================================================================================================
+
+// d = a [+ b [+ c]]; "b" and "c" are unused if NULL, and d = FILL_VALUE if "a" is NULL
+inline static void span_scalar(float* restrict d, const float* restrict a, const float* restrict b, const float* restrict c, long n, int nt)
+{
+	(void) nt;
+	if (a == NULL)
+	{
+		for (long i = 0; i < n; i++) d[i] = FILL_VALUE;
+	}
+	else if (c != NULL)
+	{
+		for (long i = 0; i < n; i++) d[i] = a[i] + b[i] + c[i];
+	}
+	else if (b != NULL)
+	{
+		for (long i = 0; i < n; i++) d[i] = a[i] + b[i];
+	}
+	else
+	{
+		for (long i = 0; i < n; i++) d[i] = a[i];
+	}
+}
+
+inline static float read_scalar(const float* restrict a, long n)
+{
+	float sum = 0;
+	for (long i = 0; i < n; i++) sum += a[i];
+	return sum;
+}
+
+// d += FILL_VALUE
+inline static void inc_scalar(float* restrict d, long n)
+{
+	for (long i = 0; i < n; i++) d[i] += FILL_VALUE;
+}
+
+#ifdef CPU_X86
+// Non-temporal stores need aligned addresses; the unaligned head of a span, and its tail, are written with regular stores
+__attribute__((target("avx2")))
+inline static void span_avx2(float* restrict d, const float* restrict a, const float* restrict b, const float* restrict c, long n, int nt)
+{
+	long i = 0;
+	if (nt)
+	{
+		long head = ((32 - ((uintptr_t)d & 31)) & 31) / sizeof(float);
+		i = (head < n) ? head : n;
+		span_scalar(d, a, b, c, i, 0);
+	}
+
+	for (; i + 8 <= n; i += 8)
+	{
+		__m256 v = (a != NULL) ? _mm256_loadu_ps(a + i) : _mm256_set1_ps(FILL_VALUE);
+		if (b != NULL) v = _mm256_add_ps(v, _mm256_loadu_ps(b + i));
+		if (c != NULL) v = _mm256_add_ps(v, _mm256_loadu_ps(c + i));
+		if (nt) _mm256_stream_ps(d + i, v); else _mm256_storeu_ps(d + i, v);
+	}
+	span_scalar(d + i, (a != NULL) ? a + i : NULL, (b != NULL) ? b + i : NULL, (c != NULL) ? c + i : NULL, n - i, 0);
+}
+
+// Four independent accumulators so that the additions do not limit the read bandwidth
+__attribute__((target("avx2")))
+inline static float read_avx2(const float* restrict a, long n)
+{
+	__m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps(), s2 = _mm256_setzero_ps(), s3 = _mm256_setzero_ps();
+	long i = 0;
+	for (; i + 32 <= n; i += 32)
+	{
+		s0 = _mm256_add_ps(s0, _mm256_loadu_ps(a + i     ));
+		s1 = _mm256_add_ps(s1, _mm256_loadu_ps(a + i +  8));
+		s2 = _mm256_add_ps(s2, _mm256_loadu_ps(a + i + 16));
+		s3 = _mm256_add_ps(s3, _mm256_loadu_ps(a + i + 24));
+	}
+	float temp[8];
+	_mm256_storeu_ps(temp, _mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3)));
+	return read_scalar(temp, 8) + read_scalar(a + i, n - i);
+}
+
+__attribute__((target("avx2")))
+inline static void inc_avx2(float* restrict d, long n)
+{
+	__m256 v = _mm256_set1_ps(FILL_VALUE);
+	long i = 0;
+	for (; i + 8 <= n; i += 8)
+	{
+		_mm256_storeu_ps(d + i, _mm256_add_ps(_mm256_loadu_ps(d + i), v));
+	}
+	inc_scalar(d + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+inline static void span_avx512(float* restrict d, const float* restrict a, const float* restrict b, const float* restrict c, long n, int nt)
+{
+	long i = 0;
+	if (nt)
+	{
+		long head = ((64 - ((uintptr_t)d & 63)) & 63) / sizeof(float);
+		i = (head < n) ? head : n;
+		span_scalar(d, a, b, c, i, 0);
+	}
+
+	for (; i + 16 <= n; i += 16)
+	{
+		__m512 v = (a != NULL) ? _mm512_loadu_ps(a + i) : _mm512_set1_ps(FILL_VALUE);
+		if (b != NULL) v = _mm512_add_ps(v, _mm512_loadu_ps(b + i));
+		if (c != NULL) v = _mm512_add_ps(v, _mm512_loadu_ps(c + i));
+		if (nt) _mm512_stream_ps(d + i, v); else _mm512_storeu_ps(d + i, v);
+	}
+	span_scalar(d + i, (a != NULL) ? a + i : NULL, (b != NULL) ? b + i : NULL, (c != NULL) ? c + i : NULL, n - i, 0);
+}
+
+__attribute__((target("avx512f")))
+inline static float read_avx512(const float* restrict a, long n)
+{
+	__m512 s0 = _mm512_setzero_ps(), s1 = _mm512_setzero_ps(), s2 = _mm512_setzero_ps(), s3 = _mm512_setzero_ps();
+	long i = 0;
+	for (; i + 64 <= n; i += 64)
+	{
+		s0 = _mm512_add_ps(s0, _mm512_loadu_ps(a + i     ));
+		s1 = _mm512_add_ps(s1, _mm512_loadu_ps(a + i + 16));
+		s2 = _mm512_add_ps(s2, _mm512_loadu_ps(a + i + 32));
+		s3 = _mm512_add_ps(s3, _mm512_loadu_ps(a + i + 48));
+	}
+	return _mm512_reduce_add_ps(_mm512_add_ps(_mm512_add_ps(s0, s1), _mm512_add_ps(s2, s3))) + read_scalar(a + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+inline static void inc_avx512(float* restrict d, long n)
+{
+	__m512 v = _mm512_set1_ps(FILL_VALUE);
+	long i = 0;
+	for (; i + 16 <= n; i += 16)
+	{
+		_mm512_storeu_ps(d + i, _mm512_add_ps(_mm512_loadu_ps(d + i), v));
+	}
+	inc_scalar(d + i, n - i);
+}
+#endif
+
+typedef void  (*span_fn)(float* restrict, const float* restrict, const float* restrict, const float* restrict, long, int);
+typedef float (*read_fn)(const float* restrict, long);
+typedef void  (*inc_fn) (float* restrict, long);
+
+#ifdef CPU_X86
+static const span_fn span_kernels[NUM_SIMD] = {span_scalar, span_avx2, span_avx512};
+static const read_fn read_kernels[NUM_SIMD] = {read_scalar, read_avx2, read_avx512};
+static const inc_fn  inc_kernels [NUM_SIMD] = {inc_scalar , inc_avx2 , inc_avx512 };
+#else
+static const span_fn span_kernels[NUM_SIMD] = {span_scalar, span_scalar, span_scalar};
+static const read_fn read_kernels[NUM_SIMD] = {read_scalar, read_scalar, read_scalar};
+static const inc_fn  inc_kernels [NUM_SIMD] = {inc_scalar , inc_scalar , inc_scalar };
+#endif
+
+static volatile float cpu_sink; // sum of the halo indexes read by in-place kernels
+
+//====================================================================================================================================
+// Traversal
+//====================================================================================================================================
+
+// Runs a kernel over every block of the grid, including the halo around each block; every row of a block is one span and the
+// spans are distributed statically among the threads, so halo indexes are accessed redundantly exactly as on the device
+// In-place kernels split every span into the halo on either side, which is only read, and the valid part of the block
+inline static void cpu_run(const cpu_grid_t* g, const cpu_op_t* op, int simd, int nt)
+{
+	span_fn span = span_kernels[simd];
+	read_fn read = read_kernels[simd];
+	inc_fn  inc  = inc_kernels[simd];
+
+	long valid_x = g->block_x - 2 * g->halo;
+	long num_blk_x = (g->dim_x + valid_x - 1) / valid_x;
+	long block_y = (g->dims == 3) ? g->block_y : g->dim_y;
+	long halo_y  = (g->dims == 3) ? g->halo    : 0;
+	long valid_y = block_y - 2 * halo_y;
+	long num_blk_y = (g->dim_y + valid_y - 1) / valid_y;
+	long row = g->pad_x + g->dim_x;
+	long plane = row * (g->pad_y + g->dim_y);
+	float sum = 0;
+
+	#pragma omp parallel default(none) firstprivate(g, op, span, read, inc, nt, valid_x, num_blk_x, block_y, halo_y, valid_y, num_blk_y, row, plane) reduction(+:sum)
+	{
+		#pragma omp for collapse(4) schedule(static)
+		for (long by = 0; by < num_blk_y; by++)
+		{
+			for (long bx = 0; bx < num_blk_x; bx++)
+			{
+				for (long z = 0; z < g->dim_z; z++)
+				{
+					for (long y = 0; y < block_y; y++)
+					{
+						long gy = by * valid_y + y - halo_y;
+						long start = bx * valid_x - g->halo;
+						long end = start + g->block_x;
+						start = (start < 0) ? 0 : start;
+						end = (end > g->dim_x) ? g->dim_x : end;
+						if (gy < 0 || gy >= g->dim_y || start >= end) continue;
+
+						long index = g->pad + z * plane + (g->pad_y + gy) * row + (g->pad_x + start);
+						long n = end - start;
+
+						if (op->num_outputs == 0)
+						{
+							sum += read(op->in[0] + index, n);
+						}
+						else if (op->inplace)
+						{
+							long first = (bx * valid_x > start) ? bx * valid_x : start;
+							long last = (bx * valid_x + valid_x < end) ? bx * valid_x + valid_x : end;
+							if (y < halo_y || y >= block_y - halo_y || first >= last)
+							{
+								sum += read(op->out[0] + index, n);
+							}
+							else
+							{
+								sum += read(op->out[0] + index, first - start);
+								inc(op->out[0] + index + (first - start), last - first);
+								sum += read(op->out[0] + index + (last - start), end - last);
+							}
+						}
+						else if (op->num_inputs == 0)
+						{
+							for (int j = 0; j < op->num_outputs; j++)
+							{
+								span(op->out[j] + index, NULL, NULL, NULL, n, nt);
+							}
+						}
+						else if (op->copy)
+						{
+							for (int j = 0; j < op->num_outputs; j++)
+							{
+								span(op->out[j] + index, op->in[j] + index, NULL, NULL, n, nt);
+							}
+						}
+						else
+						{
+							span(op->out[0] + index, op->in[0] + index, (op->num_inputs > 1) ? op->in[1] + index : NULL, (op->num_inputs > 2) ? op->in[2] + index : NULL, n, nt);
+						}
+					}
+				}
+			}
+		}
+
+#ifdef CPU_X86
+		if (nt) _mm_sfence(); // make non-temporal stores of every thread visible before the run is timed as complete
+#endif
+	}
+
+	// to prevent the compiler from optimizing out the memory accesses
+	if (op->num_outputs == 0)
+	{
+		op->sink[0] = sum;
+	}
+	else if (op->inplace)
+	{
+		cpu_sink = sum;
+	}
+}
+
+#endif // CPU_H
@@ -0,0 +1,137 @@
+//====================================================================================================================================
+// Element types of the buffers: kernel files are built for one of them with DTYPE, and the host fills and verifies the buffers
+// through accessors that convert every scalar to and from double
+// "wide" elements are 512-bit vectors of 16 floats, so that a single element fills the memory word of a 512-bit port
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef DTYPE_H
+#define DTYPE_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+enum {DTYPE_FLOAT, DTYPE_DOUBLE, DTYPE_HALF, DTYPE_INT8, DTYPE_INT16, DTYPE_INT32, DTYPE_INT64, DTYPE_WIDE, NUM_DTYPES};
+static const char* const dtype_names[NUM_DTYPES]    = {"float", "double", "half", "int8", "int16", "int32", "int64", "wide"   };
+static const char* const dtype_cl_names[NUM_DTYPES] = {"float", "double", "half", "char", "short", "int"  , "long" , "float16"}; // value of DTYPE
+static const int dtype_sizes[NUM_DTYPES]            = {4      , 8       , 2     , 1     , 2      , 4      , 8      , 64       }; // bytes per element
+static const int dtype_lanes[NUM_DTYPES]            = {1      , 1       , 1     , 1     , 1      , 1      , 1      , 16       }; // scalars per element
+
+// Inputs of integer types and half are random integers below this bound, so that the sums of the verified kernels are exact and
+// fit in the type; inputs of the other types are random real numbers between 0 and 1000
+static const long dtype_bounds[NUM_DTYPES]          = {0      , 0       , 128   , 16    , 2048   , 1 << 24, 1 << 24, 0        };
+
+// Returns the index of the given element type name, or -1 if unknown
+inline static int parse_dtype(const char* name)
+{
+	for (int i = 0; i < NUM_DTYPES; i++)
+	{
+		if (strcmp(name, dtype_names[i]) == 0)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+// IEEE 754 half-precision conversions, rounding to nearest even; OpenCL half buffers are accessed as 16-bit integers on the host
+inline static uint16_t half_from_float(float value)
+{
+	uint32_t x;
+	memcpy(&x, &value, sizeof(x));
+	uint32_t sign = (x >> 16) & 0x8000;
+	int      exp  = (int)((x >> 23) & 0xff) - 127 + 15;
+	uint32_t mant = x & 0x7fffff;
+
+	if (exp >= 31) // overflow to infinity; NaN stays NaN
+	{
+		return sign | 0x7c00 | (((x & 0x7fffffff) > 0x7f800000) ? 0x200 : 0);
+	}
+	if (exp <= 0) // subnormal or zero
+	{
+		if (exp < -10) return sign;
+		mant |= 0x800000;
+		int shift = 14 - exp;
+		uint32_t h = mant >> shift, rem = mant & ((1u << shift) - 1), halfway = 1u << (shift - 1);
+		if (rem > halfway || (rem == halfway && (h & 1))) h++;
+		return sign | h;
+	}
+
+	// a carry out of the mantissa correctly moves the value to the next exponent
+	uint32_t h = sign | ((uint32_t)exp << 10) | (mant >> 13), rem = mant & 0x1fff;
+	if (rem > 0x1000 || (rem == 0x1000 && (h & 1))) h++;
+	return h;
+}
+
+inline static float half_to_float(uint16_t h)
+{
+	uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+	uint32_t exp  = (h >> 10) & 0x1f;
+	uint32_t mant = h & 0x3ff;
+	uint32_t x;
+	float value;
+
+	if (exp == 0) // subnormal or zero
+	{
+		value = ldexpf((float)mant, -24);
+		return sign ? -value : value;
+	}
+	x = sign | ((exp == 31) ? 0x7f800000 | (mant << 13) : ((exp - 15 + 127) << 23) | (mant << 13));
+	memcpy(&value, &x, sizeof(value));
+	return value;
+}
+
+// Value of scalar i of a buffer; scalars of "wide" elements are in lane order, i.e. scalar i is lane i % 16 of element i / 16
+inline static double dtype_get(const void* buffer, int dtype, long i)
+{
+	switch (dtype)
+	{
+		case DTYPE_DOUBLE: return ((const double*  )buffer)[i];
+		case DTYPE_HALF  : return half_to_float(((const uint16_t*)buffer)[i]);
+		case DTYPE_INT8  : return ((const int8_t*  )buffer)[i];
+		case DTYPE_INT16 : return ((const int16_t* )buffer)[i];
+		case DTYPE_INT32 : return ((const int32_t* )buffer)[i];
+		case DTYPE_INT64 : return ((const int64_t* )buffer)[i];
+		default          : return ((const float*   )buffer)[i];
+	}
+}
+
+inline static void dtype_set(void* buffer, int dtype, long i, double value)
+{
+	switch (dtype)
+	{
+		case DTYPE_DOUBLE: ((double*  )buffer)[i] = value;                          break;
+		case DTYPE_HALF  : ((uint16_t*)buffer)[i] = half_from_float((float)value);  break;
+		case DTYPE_INT8  : ((int8_t*  )buffer)[i] = (int8_t )(int64_t)value;        break;
+		case DTYPE_INT16 : ((int16_t* )buffer)[i] = (int16_t)(int64_t)value;        break;
+		case DTYPE_INT32 : ((int32_t* )buffer)[i] = (int32_t)(int64_t)value;        break;
+		case DTYPE_INT64 : ((int64_t* )buffer)[i] = (int64_t)value;                 break;
+		default          : ((float*   )buffer)[i] = (float)value;                   break;
+	}
+}
+
+// Value as stored in a scalar of the type, used to round the expected values of the verifier after every addition exactly as on the
+// device; integer types wrap around
+inline static double dtype_round(int dtype, double value)
+{
+	switch (dtype)
+	{
+		case DTYPE_DOUBLE: return value;
+		case DTYPE_HALF  : return half_to_float(half_from_float((float)value));
+		case DTYPE_INT8  : return (int8_t )(int64_t)value;
+		case DTYPE_INT16 : return (int16_t)(int64_t)value;
+		case DTYPE_INT32 : return (int32_t)(int64_t)value;
+		case DTYPE_INT64 : return (double)(int64_t)value;
+		default          : return (float)value;
+	}
+}
+
+// Random input value of the type, see dtype_bounds
+inline static double dtype_random(int dtype, unsigned int* seed)
+{
+	return (dtype_bounds[dtype] > 0) ? (double)(rand_r(seed) % dtype_bounds[dtype]) : 1000.0 * (float)rand_r(seed) / (float)(RAND_MAX);
+}
+
+#endif // DTYPE_H
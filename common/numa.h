@@ -0,0 +1,271 @@
+//====================================================================================================================================
+// NUMA placement of host buffers and pinning of host threads, implemented with Linux system calls so that libnuma is not needed
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef NUMA_H
+#define NUMA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <omp.h>
+
+#ifdef __linux
+	#include <sched.h> // CPU affinity macros need _GNU_SOURCE to be defined before the first system header
+	#include <sys/syscall.h>
+#endif
+
+#define NUMA_MAX_NODES   64    // nodes are kept in a single 64-bit mask
+#define NUMA_LOCAL       -1    // default first-touch placement, or no pinning
+#define NUMA_INTERLEAVE  -2    // buffers interleaved page by page between all nodes with memory
+#define NUMA_ALL         -2    // threads pinned one per CPU over all allowed CPUs
+
+// memory policies and flags of mbind(), from <linux/mempolicy.h>
+#define NUMA_MPOL_BIND       2
+#define NUMA_MPOL_INTERLEAVE 3
+#define NUMA_MPOL_MF_STRICT  (1 << 0)
+#define NUMA_MPOL_MF_MOVE    (1 << 1)
+
+// Placement selected on the command line
+typedef struct
+{
+	int mem; // node the host buffers are bound to, NUMA_LOCAL or NUMA_INTERLEAVE
+	int cpu; // node whose CPUs the host threads are pinned to, NUMA_LOCAL or NUMA_ALL
+} numa_config_t;
+
+// Returns the node number, or NUMA_LOCAL/"local" and the given special value for "special"; exits on invalid values
+inline static int numa_parse(const char* option, const char* value, const char* special, int special_value)
+{
+	if (strcmp(value, "local") == 0)
+	{
+		return NUMA_LOCAL;
+	}
+	if (strcmp(value, special) == 0)
+	{
+		return special_value;
+	}
+
+	char* end;
+	long node = strtol(value, &end, 10);
+	if (*end != '\0' || node < 0 || node >= NUMA_MAX_NODES)
+	{
+		printf("Invalid value for %s: %s\n", option, value);
+		exit(-1);
+	}
+	return (int)node;
+}
+
+// Name of a placement for reports, or NULL for the default placement
+inline static const char* numa_name(int node, char* name)
+{
+	if (node == NUMA_LOCAL) return NULL;
+	if (node == NUMA_INTERLEAVE) return "interleave";
+	sprintf(name, "%d", node);
+	return name;
+}
+
+//====================================================================================================================================
+// Topology
+//====================================================================================================================================
+
+// Reads a list like "0-3,8,10-11" from sysfs and calls "add" for every number in it; returns zero if the file cannot be read
+inline static int numa_read_list(const char* path, void (*add)(int, void*), void* arg)
+{
+	char line[4096];
+	FILE* file = fopen(path, "r");
+	if (file == NULL)
+	{
+		return 0;
+	}
+	if (fgets(line, sizeof(line), file) == NULL)
+	{
+		line[0] = '\0';
+	}
+	fclose(file);
+
+	char* save = NULL;
+	for (char* token = strtok_r(line, ",\n", &save); token != NULL; token = strtok_r(NULL, ",\n", &save))
+	{
+		int first, last;
+		int count = sscanf(token, "%d-%d", &first, &last);
+		if (count < 1) continue;
+		if (count == 1) last = first;
+		for (int i = first; i <= last; i++)
+		{
+			add(i, arg);
+		}
+	}
+	return 1;
+}
+
+inline static void numa_add_node(int node, void* mask)
+{
+	if (node < NUMA_MAX_NODES) *(unsigned long*)mask |= 1UL << node;
+}
+
+// Mask of the nodes that have memory; a single node if NUMA information is not available
+inline static unsigned long numa_memory_nodes()
+{
+	unsigned long mask = 0;
+	if (!numa_read_list("/sys/devices/system/node/has_memory", numa_add_node, &mask) && !numa_read_list("/sys/devices/system/node/online", numa_add_node, &mask))
+	{
+		mask = 1;
+	}
+	return mask;
+}
+
+#ifdef __linux
+inline static void numa_add_cpu(int cpu, void* set)
+{
+	if (cpu < CPU_SETSIZE) CPU_SET(cpu, (cpu_set_t*)set);
+}
+#endif
+
+//====================================================================================================================================
+// Buffer placement
+//====================================================================================================================================
+
+// Sets the placement of a page-aligned range of memory; the policy applies to pages that are not touched yet, so it must be set
+// before the memory is first touched for every page to end up on the selected nodes no matter which thread touches it first
+inline static void numa_bind(void* ptr, size_t length, int node)
+{
+	if (node == NUMA_LOCAL)
+	{
+		return;
+	}
+
+#ifdef __linux
+	unsigned long mask = (node == NUMA_INTERLEAVE) ? numa_memory_nodes() : 1UL << node;
+	if ((mask & numa_memory_nodes()) == 0)
+	{
+		printf("NUMA node %d does not exist or has no memory!\n", node);
+		exit(-1);
+	}
+	if (syscall(SYS_mbind, ptr, length, (node == NUMA_INTERLEAVE) ? NUMA_MPOL_INTERLEAVE : NUMA_MPOL_BIND, &mask, NUMA_MAX_NODES + 1, NUMA_MPOL_MF_STRICT | NUMA_MPOL_MF_MOVE) != 0)
+	{
+		perror("ERROR: mbind() failed");
+		exit(-1);
+	}
+#else
+	(void) ptr; (void) length;
+	printf("NUMA placement is only supported on Linux!\n");
+	exit(-1);
+#endif
+}
+
+// Prints the share of the pages of a buffer on every node, as reported by the kernel; pages not allocated yet are listed apart
+inline static void numa_print_placement(char buffer, const void* ptr, size_t size)
+{
+	char name[32];
+	sprintf(name, "Buffer %c placement:", buffer);
+
+#ifdef __linux
+	#define NUMA_CHUNK 4096
+	long page = sysconf(_SC_PAGESIZE);
+	long first = (long)((size_t)ptr / page), last = (long)(((size_t)ptr + size - 1) / page);
+	long num_pages = last - first + 1;
+	long pages[NUMA_MAX_NODES + 1] = {0}; // last entry counts pages that are not allocated
+	void* addr[NUMA_CHUNK];
+	int status[NUMA_CHUNK];
+
+	for (long i = 0; i < num_pages; i += NUMA_CHUNK)
+	{
+		long count = (num_pages - i < NUMA_CHUNK) ? num_pages - i : NUMA_CHUNK;
+		for (long j = 0; j < count; j++)
+		{
+			addr[j] = (void*)((first + i + j) * page);
+		}
+		if (syscall(SYS_move_pages, 0, count, addr, NULL, status, 0) != 0)
+		{
+			printf("%-23snot available\n", name);
+			return;
+		}
+		for (long j = 0; j < count; j++)
+		{
+			pages[(status[j] >= 0 && status[j] < NUMA_MAX_NODES) ? status[j] : NUMA_MAX_NODES]++;
+		}
+	}
+
+	const char* separator = "";
+	printf("%-23s", name);
+	for (int n = 0; n <= NUMA_MAX_NODES; n++)
+	{
+		if (pages[n] == 0) continue;
+		if (n < NUMA_MAX_NODES) printf("%snode %d: %.1f%%", separator, n, (double)pages[n] * 100.0 / (double)num_pages);
+		else printf("%snot allocated: %.1f%%", separator, (double)pages[n] * 100.0 / (double)num_pages);
+		separator = ", ";
+	}
+	printf("\n");
+	#undef NUMA_CHUNK
+#else
+	(void) ptr; (void) size;
+	printf("%-23snot available\n", name);
+#endif
+}
+
+//====================================================================================================================================
+// Thread pinning
+//====================================================================================================================================
+
+// Pins every OpenMP thread, and with it the host thread that drives OpenCL, to its own CPU of the given node, or of all CPUs the
+// process may run on; threads are assigned in CPU order and wrap around if there are more threads than CPUs
+// OpenMP runtimes keep the same threads for parallel regions of the same size, so the pinning holds for all later regions
+inline static void numa_pin_threads(int node)
+{
+	if (node == NUMA_LOCAL)
+	{
+		return;
+	}
+
+#ifdef __linux
+	cpu_set_t allowed, cpus;
+	char path[64];
+	int list[CPU_SETSIZE], num_cpus = 0;
+
+	CPU_ZERO(&cpus);
+	sched_getaffinity(0, sizeof(allowed), &allowed);
+	if (node == NUMA_ALL)
+	{
+		cpus = allowed;
+	}
+	else
+	{
+		sprintf(path, "/sys/devices/system/node/node%d/cpulist", node);
+		if (!numa_read_list(path, numa_add_cpu, &cpus))
+		{
+			printf("NUMA node %d does not exist!\n", node);
+			exit(-1);
+		}
+		CPU_AND(&cpus, &cpus, &allowed);
+	}
+	for (int i = 0; i < CPU_SETSIZE; i++)
+	{
+		if (CPU_ISSET(i, &cpus)) list[num_cpus++] = i;
+	}
+	if (num_cpus == 0)
+	{
+		printf("No CPUs of NUMA node %d are available to this process!\n", node);
+		exit(-1);
+	}
+
+	#pragma omp parallel default(none) firstprivate(list, num_cpus)
+	{
+		cpu_set_t set;
+		int cpu = list[omp_get_thread_num() % num_cpus];
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		if (sched_setaffinity(0, sizeof(set), &set) != 0)
+		{
+			perror("ERROR: sched_setaffinity() failed");
+			exit(-1);
+		}
+	}
+#else
+	printf("Thread pinning is only supported on Linux!\n");
+	exit(-1);
+#endif
+}
+
+#endif // NUMA_H
@@ -0,0 +1,320 @@
+//====================================================================================================================================
+// Machine-readable (JSON/CSV) output of benchmark results
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef REPORT_H
+#define REPORT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "stats.h"
+
+#define FORMAT_TEXT 0
+#define FORMAT_JSON 1 // one JSON object per line (JSON Lines)
+#define FORMAT_CSV  2
+
+// Benchmark configuration reported with every record; values that do not apply to a kernel type are reported as zero
+typedef struct
+{
+	const char* type;       // kernel type, same as the make target
+	const char* model;      // "NDR", "SWI", or "CPU" for the CPU backend
+	int    vec;             // vector size
+	const char* dtype;      // element type of the buffers
+	int    block_x;         // block size in x dimension
+	int    block_y;         // block size in y dimension
+	int    interleave;      // interleaving of buffers between memory banks
+	int    cache;           // compiler-generated caches of global loads, -1 on the CPU backend
+	const char* banks;      // memory bank of every buffer as "A=1,B=2,...", NULL if buffers are interleaved
+	const char* simd;       // SIMD code path of the CPU backend with "_nt" for non-temporal stores, NULL on OpenCL devices
+	int    threads;         // number of threads of the CPU backend
+	const char* numa_mem;   // NUMA node of the host buffers or "interleave", NULL for first-touch placement
+	const char* numa_cpu;   // NUMA node the host threads are pinned to or "all", NULL if not pinned
+	const char* alloc;      // allocation mode of host buffers
+	double staging_time;    // time in ms to write the inputs to the device, zero if there is no device
+	long   staging_B;       // bytes written to the device
+	double fmax;            // post-place-and-route operating frequency in MHz, zero if unknown
+	int    pad, pad_x, pad_y;
+	int    halo;
+	int    stride;          // distance between consecutive accesses in vectors
+	int    reads, writes;   // buffers read and written per index by the read/write mix kernel, or fields read and sums written
+	                        // per record by the record layout kernels
+	int    tile;            // records per tile of the AoSoA record layout, zero for other kernels
+	int    fmas;            // FMAs per element of the compute kernel of compute pipelines, zero for other kernels
+	const char* locality;   // locality of the indexes of indirect kernels, NULL for direct kernels
+	long   window_B;        // window of block-random and jittered indexes
+	long   accesses;        // indirect accesses or dependent loads per run, zero for direct kernels
+	long   flops;           // floating-point operations per run of compute pipelines, zero for other kernels
+	int    latency;         // accesses are dependent loads, reported with their latency based on device-side run time
+	long   dim_x, dim_y, dim_z;
+	long   size_B;          // size of each buffer in bytes
+	long   total_B;         // bytes accessed per buffer including redundant accesses caused by halo
+	int    warmup, iqr;
+	int    copies;          // copies of the kernel run concurrently
+	int    shared;          // the copies access the same buffers
+	int    copy;            // copy the record is about, -1 for all copies together
+	double fairness;        // Jain's fairness index of the bandwidth of the copies
+	int    device;          // OpenCL device ID of the copy, or the selected device for all copies together
+	int    devices;         // devices the kernels run on
+	int    peer;            // device of the second kernel binary of multi-device types, -1 for other types
+	const char* topology;   // links between the devices of the serial channel, NULL for other types
+	int    chan_depth;      // depth of the channels in channel words, -1 for types without channels
+	int    chan_width;      // elements per channel word, -1 for types without channels
+} config_t;
+
+// Returns the format for the given name, or -1 if unknown
+inline static int parse_format(const char* name)
+{
+	if (strcmp(name, "text") == 0)
+	{
+		return FORMAT_TEXT;
+	}
+	else if (strcmp(name, "json") == 0)
+	{
+		return FORMAT_JSON;
+	}
+	else if (strcmp(name, "csv") == 0)
+	{
+		return FORMAT_CSV;
+	}
+	return -1;
+}
+
+// Reads the post-place-and-route Fmax in MHz from the Quartus report of an FPGA bitstream
+// The aocx file is expected to be the "<folder>/<name>.aocx" output of the OpenCL compiler, or a symbolic link to it,
+// with the report in "<folder>/<name>/acl_quartus_report.txt"; returns zero if the report cannot be found
+inline static double get_fmax(const char* aocx)
+{
+	char path[PATH_MAX + 32], line[256];
+	double fmax = 0;
+
+	if (realpath(aocx, path) == NULL)
+	{
+		return 0;
+	}
+	char* ext = strrchr(path, '.');
+	if (ext == NULL || strcmp(ext, ".aocx") != 0)
+	{
+		return 0;
+	}
+	strcpy(ext, "/acl_quartus_report.txt");
+
+	FILE* report = fopen(path, "r");
+	if (report == NULL)
+	{
+		return 0;
+	}
+	while (fgets(line, sizeof(line), report) != NULL)
+	{
+		if (strncmp(line, "Actual clock freq", 17) == 0 && strchr(line, ':') != NULL)
+		{
+			fmax = atof(strchr(line, ':') + 1);
+			break;
+		}
+	}
+	fclose(report);
+	return fmax;
+}
+
+// Prints the CSV column names; does nothing for other formats
+inline static void report_header(int format)
+{
+	if (format != FORMAT_CSV)
+	{
+		return;
+	}
+
+	printf("type,model,vec,dtype,block_x,block_y,interleave,cache,banks,simd,threads,numa_mem,numa_cpu,alloc,staging_B,staging_time,fmax,pad,pad_x,pad_y,halo,stride,reads,writes,tile,fmas,locality,window_B,dim_x,dim_y,dim_z,size_B,total_B,redundancy,kernel,copy,copies,shared,fairness,device,devices,peer,topology,chan_depth,chan_width,bytes,accesses,flops,latency_ns,latency_cycles,iterations,warmup,iqr");
+	const char* sources[2] = {"host", "device"};
+	for (int i = 0; i < 2; i++)
+	{
+		printf(",%s_samples_used,%s_rejected,%s_time,%s_mean,%s_min,%s_median,%s_p95,%s_max,%s_stddev,%s_ci", sources[i], sources[i], sources[i], sources[i], sources[i], sources[i], sources[i], sources[i], sources[i], sources[i]);
+	}
+	printf(",host_times,device_times\n");
+}
+
+// Prints a string field followed by a comma, or null if the string is NULL
+inline static void report_string_json(const char* name, const char* value)
+{
+	if (value != NULL)
+	{
+		printf("\"%s\":\"%s\",", name, value);
+	}
+	else
+	{
+		printf("\"%s\":null,", name);
+	}
+}
+
+inline static void report_stats_json(const char* name, const stats_t* stats)
+{
+	printf("\"%s\":{\"samples\":%d,\"rejected\":%d,\"time\":%.6f,\"mean\":%.6f,\"min\":%.6f,\"median\":%.6f,\"p95\":%.6f,\"max\":%.6f,\"stddev\":%.6f,\"ci\":%.6f}",
+	       name, stats->samples, stats->rejected, stats->time, stats->mean, stats->min, stats->median, stats->p95, stats->max, stats->stddev, stats->ci);
+}
+
+inline static void report_times_json(const char* name, const double* times, int count)
+{
+	printf("\"%s\":[", name);
+	for (int i = 0; i < count; i++)
+	{
+		printf("%s%.6f", (i == 0) ? "" : ",", times[i]);
+	}
+	printf("]");
+}
+
+inline static void report_stats_csv(const stats_t* stats)
+{
+	printf(",%d,%d,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f", stats->samples, stats->rejected, stats->time, stats->mean, stats->min, stats->median, stats->p95, stats->max, stats->stddev, stats->ci);
+}
+
+// Samples are written as a single field separated by semicolons
+inline static void report_times_csv(const double* times, int count)
+{
+	printf(",");
+	for (int i = 0; i < count; i++)
+	{
+		printf("%s%.6f", (i == 0) ? "" : ";", times[i]);
+	}
+}
+
+// Prints one record for a kernel that transfers "bytes" bytes per run, including all timing samples in ms and bandwidth statistics in GB/s
+inline static void report_record(int format, const config_t* config, const char* kernel, long bytes, const samples_t* samples, const stats_t* host, const stats_t* device)
+{
+	double redundancy = (config->total_B > 0 && !config->latency) ? (double)(config->total_B - config->size_B) * 100.0 / (double)config->total_B : 0;
+	double latency = (config->latency && config->accesses > 0) ? device->time * 1.0E6 / (double)config->accesses : 0;
+	char latency_ns[32] = "", latency_cycles[32] = "";
+	if (latency > 0) sprintf(latency_ns, "%.3f", latency);
+	if (latency > 0 && config->fmax > 0) sprintf(latency_cycles, "%.3f", latency * config->fmax / 1000.0);
+
+	if (format == FORMAT_JSON)
+	{
+		printf("{\"type\":\"%s\",\"model\":\"%s\",\"vec\":%d,\"dtype\":\"%s\",\"block_x\":%d,\"block_y\":%d,\"interleave\":%s,\"cache\":%s,", config->type, config->model, config->vec, config->dtype, config->block_x, config->block_y, config->interleave ? "true" : "false", (config->cache < 0) ? "null" : config->cache ? "true" : "false");
+		report_string_json("banks", config->banks);
+		if (config->simd != NULL)
+		{
+			printf("\"simd\":\"%s\",\"threads\":%d,", config->simd, config->threads);
+		}
+		else
+		{
+			printf("\"simd\":null,\"threads\":null,");
+		}
+		report_string_json("numa_mem", config->numa_mem);
+		report_string_json("numa_cpu", config->numa_cpu);
+		report_string_json("alloc", config->alloc);
+		if (config->staging_B > 0)
+		{
+			printf("\"staging_B\":%ld,\"staging_time\":%.6f,", config->staging_B, config->staging_time);
+		}
+		else
+		{
+			printf("\"staging_B\":null,\"staging_time\":null,");
+		}
+		if (config->fmax > 0)
+		{
+			printf("\"fmax\":%.2f,", config->fmax);
+		}
+		else
+		{
+			printf("\"fmax\":null,");
+		}
+		printf("\"pad\":%d,\"pad_x\":%d,\"pad_y\":%d,\"halo\":%d,\"stride\":%d,\"reads\":%d,\"writes\":%d,\"tile\":%d,\"fmas\":%d,", config->pad, config->pad_x, config->pad_y, config->halo, config->stride, config->reads, config->writes, config->tile, config->fmas);
+		report_string_json("locality", config->locality);
+		printf("\"window_B\":%ld,\"dim_x\":%ld,\"dim_y\":%ld,\"dim_z\":%ld,\"size_B\":%ld,\"total_B\":%ld,\"redundancy\":%.4f,",
+		       config->window_B, config->dim_x, config->dim_y, config->dim_z, config->size_B, config->total_B, redundancy);
+		printf("\"kernel\":\"%s\",", kernel);
+		if (config->copy >= 0)
+		{
+			printf("\"copy\":%d,", config->copy);
+		}
+		else
+		{
+			printf("\"copy\":null,");
+		}
+		printf("\"copies\":%d,\"shared\":%s,\"fairness\":%.6f,\"device\":%d,\"devices\":%d,", config->copies, config->shared ? "true" : "false", config->fairness, config->device, config->devices);
+		if (config->peer >= 0)
+		{
+			printf("\"peer\":%d,", config->peer);
+		}
+		else
+		{
+			printf("\"peer\":null,");
+		}
+		if (config->topology != NULL)
+		{
+			printf("\"topology\":\"%s\",", config->topology);
+		}
+		else
+		{
+			printf("\"topology\":null,");
+		}
+		if (config->chan_depth >= 0)
+		{
+			printf("\"chan_depth\":%d,\"chan_width\":%d,", config->chan_depth, config->chan_width);
+		}
+		else
+		{
+			printf("\"chan_depth\":null,\"chan_width\":null,");
+		}
+		printf("\"bytes\":%ld,\"accesses\":%ld,\"flops\":%ld,\"latency_ns\":%s,\"latency_cycles\":%s,\"iterations\":%d,\"warmup\":%d,\"iqr\":%s,", bytes, config->accesses, config->flops,
+		       (latency_ns[0] != '\0') ? latency_ns : "null", (latency_cycles[0] != '\0') ? latency_cycles : "null", samples->count, config->warmup, config->iqr ? "true" : "false");
+		report_stats_json("host", host);
+		printf(",");
+		report_stats_json("device", device);
+		printf(",");
+		report_times_json("host_times", samples->host, samples->count);
+		printf(",");
+		report_times_json("device_times", samples->device, samples->count);
+		printf("}\n");
+	}
+	else if (format == FORMAT_CSV)
+	{
+		printf("%s,%s,%d,%s,%d,%d,%d,", config->type, config->model, config->vec, config->dtype, config->block_x, config->block_y, config->interleave);
+		if (config->cache >= 0) printf("%d", config->cache);
+		printf(",");
+		for (const char* c = (config->banks != NULL) ? config->banks : ""; *c != '\0'; c++)
+		{
+			putchar((*c == ',') ? ';' : *c); // banks are written as a single field separated by semicolons
+		}
+		printf(",");
+		if (config->simd != NULL)
+		{
+			printf("%s,%d,", config->simd, config->threads);
+		}
+		else
+		{
+			printf(",,");
+		}
+		printf("%s,%s,%s,", (config->numa_mem != NULL) ? config->numa_mem : "", (config->numa_cpu != NULL) ? config->numa_cpu : "", config->alloc);
+		if (config->staging_B > 0)
+		{
+			printf("%ld,%.6f,", config->staging_B, config->staging_time);
+		}
+		else
+		{
+			printf(",,");
+		}
+		if (config->fmax > 0)
+		{
+			printf("%.2f", config->fmax);
+		}
+		printf(",%d,%d,%d,%d,%d,%d,%d,%d,%d,%s,%ld,%ld,%ld,%ld,%ld,%ld,%.4f,", config->pad, config->pad_x, config->pad_y, config->halo, config->stride, config->reads, config->writes, config->tile, config->fmas, (config->locality != NULL) ? config->locality : "", config->window_B, config->dim_x, config->dim_y, config->dim_z, config->size_B, config->total_B, redundancy);
+		printf("%s,", kernel);
+		if (config->copy >= 0) printf("%d", config->copy);
+		printf(",%d,%d,%.6f,%d,%d,", config->copies, config->shared, config->fairness, config->device, config->devices);
+		if (config->peer >= 0) printf("%d", config->peer);
+		printf(",%s,", (config->topology != NULL) ? config->topology : "");
+		if (config->chan_depth >= 0) printf("%d,%d", config->chan_depth, config->chan_width); else printf(",");
+		printf(",");
+		printf("%ld,%ld,%ld,%s,%s,%d,%d,%d", bytes, config->accesses, config->flops, latency_ns, latency_cycles, samples->count, config->warmup, config->iqr);
+		report_stats_csv(host);
+		report_stats_csv(device);
+		report_times_csv(samples->host, samples->count);
+		report_times_csv(samples->device, samples->count);
+		printf("\n");
+	}
+}
+
+#endif // REPORT_H
@@ -0,0 +1,191 @@
+//====================================================================================================================================
+// Statistics over per-iteration timing samples for benchmark reporting
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define STATS_MIN_SAMPLES 3 // minimum number of samples needed before a confidence interval is considered meaningful
+
+// Timing samples of every iteration of one kernel
+typedef struct
+{
+	double* host;   // host wall time in ms
+	double* device; // device-side run time in ms
+	int     count;  // number of recorded iterations
+} samples_t;
+
+// Statistics of one kernel; bandwidth values are in GB/s and ci is the half-width of the 95% confidence interval of the mean
+typedef struct
+{
+	int    samples;  // samples used after dropping warm-up iterations and rejecting outliers
+	int    rejected; // samples rejected as outliers
+	double time;     // mean run time in ms of the samples used
+	double mean, min, median, p95, max, stddev, ci;
+} stats_t;
+
+inline static void init_samples(samples_t* samples, int capacity)
+{
+	samples->host   = (double*) malloc(sizeof(double) * capacity);
+	samples->device = (double*) malloc(sizeof(double) * capacity);
+	samples->count  = 0;
+	if (!samples->host || !samples->device)
+	{
+		fprintf(stderr, "Failed to allocate memory for timing samples.\n");
+		exit(-1);
+	}
+}
+
+inline static void add_sample(samples_t* samples, double host, double device)
+{
+	samples->host[samples->count] = host;
+	samples->device[samples->count] = device;
+	samples->count++;
+}
+
+// Discards recorded samples so that the buffers can be reused for another run
+inline static void reset_samples(samples_t* samples)
+{
+	samples->count = 0;
+}
+
+inline static void free_samples(samples_t* samples)
+{
+	free(samples->host);
+	free(samples->device);
+}
+
+inline static int compare_double(const void* a, const void* b)
+{
+	double x = *(const double*)a, y = *(const double*)b;
+	return (x > y) - (x < y);
+}
+
+// Returns the given percentile (0.0-1.0) of a sorted array using linear interpolation between closest ranks
+inline static double percentile(const double* sorted, int count, double p)
+{
+	double pos = p * (count - 1);
+	int low = (int)pos;
+	int high = (low + 1 < count) ? low + 1 : low;
+	return sorted[low] + (pos - low) * (sorted[high] - sorted[low]);
+}
+
+// Two-sided 95% critical value of Student's t-distribution
+inline static double t_critical(int df)
+{
+	static const double table[30] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+	                                  2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+	                                  2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+	if (df < 1)
+	{
+		return 0;
+	}
+	return (df <= 30) ? table[df - 1] : 1.960;
+}
+
+// Computes mean, standard deviation and half-width of the 95% confidence interval of the mean
+inline static void mean_ci(const double* values, int count, double* mean, double* stddev, double* ci)
+{
+	double sum = 0, sq_sum = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		sum += values[i];
+	}
+	*mean = sum / count;
+
+	for (int i = 0; i < count; i++)
+	{
+		sq_sum += (values[i] - *mean) * (values[i] - *mean);
+	}
+	*stddev = (count > 1) ? sqrt(sq_sum / (count - 1)) : 0;
+	*ci = (count > 1) ? t_critical(count - 1) * (*stddev) / sqrt(count) : 0;
+}
+
+// Returns 1 once the 95% confidence interval of the mean run time of the samples after warm-up is within threshold percent of the mean
+// Always returns 0 if threshold is not positive so that the caller runs the full number of iterations
+inline static int samples_stable(const double* times, int count, int warmup, double threshold)
+{
+	double mean, stddev, ci;
+
+	if (threshold <= 0 || count - warmup < STATS_MIN_SAMPLES)
+	{
+		return 0;
+	}
+
+	mean_ci(times + warmup, count - warmup, &mean, &stddev, &ci);
+	return (ci * 100.0 <= threshold * mean);
+}
+
+// Computes bandwidth statistics of the given run times in ms for a kernel that transfers "bytes" bytes per run
+// The first "warmup" samples are dropped and, if "iqr" is set, samples outside of 1.5x the inter-quartile range are rejected
+inline static void compute_stats(const double* times, int count, double bytes, int warmup, int iqr, stats_t* stats)
+{
+	memset(stats, 0, sizeof(stats_t));
+	if (warmup >= count)
+	{
+		return;
+	}
+
+	int n = count - warmup;
+	double* sorted = (double*) malloc(sizeof(double) * n);
+	double* bandwidth = (double*) malloc(sizeof(double) * n);
+	memcpy(sorted, times + warmup, sizeof(double) * n);
+	qsort(sorted, n, sizeof(double), compare_double);
+
+	double low = sorted[0], high = sorted[n - 1];
+	if (iqr && n >= 4)
+	{
+		double q1 = percentile(sorted, n, 0.25);
+		double q3 = percentile(sorted, n, 0.75);
+		low  = q1 - 1.5 * (q3 - q1);
+		high = q3 + 1.5 * (q3 - q1);
+	}
+
+	// keep samples within range; bandwidth is sorted in ascending order since run times are sorted in ascending order
+	double sum = 0;
+	for (int i = n - 1; i >= 0; i--)
+	{
+		if (sorted[i] >= low && sorted[i] <= high)
+		{
+			bandwidth[stats->samples] = bytes / (1.0E6 * sorted[i]);
+			sum += sorted[i];
+			stats->samples++;
+		}
+	}
+	stats->rejected = n - stats->samples;
+	stats->time = sum / stats->samples;
+
+	stats->min    = bandwidth[0];
+	stats->max    = bandwidth[stats->samples - 1];
+	stats->median = percentile(bandwidth, stats->samples, 0.50);
+	stats->p95    = percentile(bandwidth, stats->samples, 0.95);
+	mean_ci(bandwidth, stats->samples, &stats->mean, &stats->stddev, &stats->ci);
+
+	free(sorted);
+	free(bandwidth);
+}
+
+inline static void print_stats_header(const char* title)
+{
+	printf("\n%s\n", title);
+	printf("%-10s %-8s %-10s %-10s %-10s %-10s %-10s %-10s %-10s\n", "Kernel", "Samples", "Min", "Median", "P95", "Max", "Mean", "Stddev", "95% CI");
+}
+
+inline static void print_stats(const char* name, stats_t* stats)
+{
+	printf("%-10s %-8d %-10.3f %-10.3f %-10.3f %-10.3f %-10.3f %-10.3f +/-%-7.3f", name, stats->samples, stats->min, stats->median, stats->p95, stats->max, stats->mean, stats->stddev, stats->ci);
+	if (stats->rejected)
+	{
+		printf(" (%d outliers rejected)", stats->rejected);
+	}
+	printf("\n");
+}
+
+#endif // STATS_H
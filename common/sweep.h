@@ -0,0 +1,113 @@
+//====================================================================================================================================
+// Parameter sweeps over lists and ranges of input values
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_SWEEP_POINTS 1024 // maximum number of values per parameter
+
+// Values of one swept parameter
+typedef struct
+{
+	int values[MAX_SWEEP_POINTS];
+	int count;
+} sweep_t;
+
+// Sets a single value; used for the default value of a parameter
+inline static void sweep_init(sweep_t* sweep, int value)
+{
+	sweep->values[0] = value;
+	sweep->count = 1;
+}
+
+inline static void sweep_add(sweep_t* sweep, int value, const char* arg)
+{
+	if (sweep->count == MAX_SWEEP_POINTS)
+	{
+		printf("Too many values in \"%s\", maximum is %d!\n", arg, MAX_SWEEP_POINTS);
+		exit(-1);
+	}
+	sweep->values[sweep->count++] = value;
+}
+
+// Parses a comma-separated list of values and ranges, e.g. "0,1,2,4" or "0:32:4" or "1,3,8:64:*2"
+// A range is "start:end[:step]" with an inclusive end and a default step of 1; "*N" as step multiplies instead of adds
+// For multiplicative ranges starting from zero the value following zero is one, so "0:32:*2" gives 0 1 2 4 8 16 32
+inline static void sweep_parse(sweep_t* sweep, const char* arg)
+{
+	char* list = strdup(arg);
+	char* save = NULL;
+
+	sweep->count = 0;
+	for (char* token = strtok_r(list, ",", &save); token != NULL; token = strtok_r(NULL, ",", &save))
+	{
+		int start, end, step = 1, multiply = 0;
+		char step_str[32] = {0};
+		int fields = sscanf(token, "%d:%d:%31s", &start, &end, step_str);
+
+		if (fields == 3)
+		{
+			multiply = (step_str[0] == '*');
+			step = atoi(step_str + multiply);
+		}
+
+		if (fields < 1 || (fields == 1 && strchr(token, ':') != NULL) || (multiply && (step < 2 || start < 0)) || (!multiply && step < 1))
+		{
+			printf("Invalid value or range \"%s\" in \"%s\"!\n", token, arg);
+			exit(-1);
+		}
+
+		if (fields == 1)
+		{
+			sweep_add(sweep, start, arg);
+			continue;
+		}
+
+		for (long value = start; value <= end; value = multiply ? ((value == 0) ? 1 : value * step) : value + step)
+		{
+			sweep_add(sweep, (int)value, arg);
+		}
+	}
+	free(list);
+
+	if (sweep->count == 0)
+	{
+		printf("No values given in \"%s\"!\n", arg);
+		exit(-1);
+	}
+}
+
+// Removes the values larger than "max", keeping the order of the others
+inline static void sweep_clamp(sweep_t* sweep, int max)
+{
+	int count = 0;
+	for (int i = 0; i < sweep->count; i++)
+	{
+		if (sweep->values[i] <= max)
+		{
+			sweep->values[count++] = sweep->values[i];
+		}
+	}
+	sweep->count = count;
+}
+
+inline static int sweep_max(const sweep_t* sweep)
+{
+	int max = sweep->values[0];
+	for (int i = 1; i < sweep->count; i++)
+	{
+		if (sweep->values[i] > max)
+		{
+			max = sweep->values[i];
+		}
+	}
+	return max;
+}
+
+#endif // SWEEP_H
@@ -432,6 +432,48 @@ inline static char* read_kernel(const char *kernel_file_path, size_t *source_siz
 	return source;
 }
 
+// Returns the earliest start and the latest end in ns of the given profiled events, both zero if there are none, and releases them
+// Requires the events to have been enqueued on command queues created with CL_QUEUE_PROFILING_ENABLE
+inline static void get_event_span(cl_event* events, int count, cl_ulong* first_start, cl_ulong* last_end)
+{
+	cl_ulong start, end;
+
+	*first_start = 0;
+	*last_end = 0;
+	if (count == 0)
+	{
+		return;
+	}
+
+	CL_SAFE_CALL( clWaitForEvents(count, events) );
+
+	for (int i = 0; i < count; i++)
+	{
+		CL_SAFE_CALL( clGetEventProfilingInfo(events[i], CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &start, NULL) );
+		CL_SAFE_CALL( clGetEventProfilingInfo(events[i], CL_PROFILING_COMMAND_END  , sizeof(cl_ulong), &end  , NULL) );
+
+		if (i == 0 || start < *first_start)
+		{
+			*first_start = start;
+		}
+		if (i == 0 || end > *last_end)
+		{
+			*last_end = end;
+		}
+
+		clReleaseEvent(events[i]);
+	}
+}
+
+// Returns the device-side execution time in ms from the earliest start to the latest end of the given profiled events and releases them
+inline static double get_event_time(cl_event* events, int count)
+{
+	cl_ulong first_start = 0, last_end = 0;
+
+	get_event_span(events, count, &first_start, &last_end);
+	return (double)(last_end - first_start) / 1000000.0;
+}
+
 inline static void* alignedMalloc(size_t size)
 {
 	void *ptr = NULL;
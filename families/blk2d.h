@@ -0,0 +1,96 @@
+//====================================================================================================================================
+// 2D overlapped (1.5D) blocking kernels and their channelized version
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_BLK2D_H
+#define FAMILY_BLK2D_H
+
+#include "../common/bench.h"
+
+static inline void blk2d_setup_point(const bench_config_t* config, point_t* p)
+{
+	long valid_blk_x = config->block_x - 2 * p->halo;
+
+	p->size_B = (long)p->dim_x * (long)p->dim_y * elem_size(config);
+	p->size_MiB = p->size_B / (1024 * 1024);
+	p->array_size = p->size_B / elem_size(config);
+	p->padded_array_size = p->pad + (long)p->dim_y * (p->pad_x + p->dim_x) + (p->pad_x + p->dim_x);
+	p->dim = 2;
+
+	p->last_x = (p->dim_x % valid_blk_x == 0) ? p->dim_x : p->dim_x + valid_blk_x - (p->dim_x % valid_blk_x);
+	long num_blk_x = p->last_x / valid_blk_x;
+	long extra_halo_x = ((p->dim_x % valid_blk_x) >= p->halo || (p->dim_x % valid_blk_x == 0)) ? 0 : p->halo - (p->dim_x % valid_blk_x); // in case the halo width in the last block is not fully traversed
+
+#ifdef INTEL_FPGA
+	p->localSize[1] = p->dim_y; // set like this to ensure the same index traversal ordering as the SWI kernel
+#else
+	p->localSize[1] = 1;        // set like this since the above case does not work on GPUs due to local work-group size limit
+#endif
+	p->localSize[0] = config->block_x / config->vec;
+	p->globalSize[0] = (config->block_x / config->vec) * num_blk_x;
+	p->globalSize[1] = p->dim_y;
+	p->loop_exit = (long)(config->block_x / config->vec) * num_blk_x * (long)p->dim_y;
+	p->total_B = ((num_blk_x * config->block_x) - (p->last_x + 2 * p->halo - p->dim_x) - extra_halo_x) * p->dim_y * elem_size(config);
+}
+
+static inline void blk2d_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad       ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad_x     ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->dim_x     ) );
+	if (!config->ndr)
+	{
+		CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->dim_y     ) );
+		CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->loop_exit ) );
+	}
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->halo      ) );
+}
+
+static inline long blk2d_index(const point_t* p, long i)
+{
+	long y = i / p->dim_x;
+	long x = i % p->dim_x;
+	return p->pad + y * (p->pad_x + p->dim_x) + (p->pad_x + x);
+}
+
+static const family_t family_blk2d = {
+	.name        = "blk2d",
+	.description = "2D overlapped blocking",
+	.dims        = 2,
+	.blocked     = 1,
+	.channelized = 0,
+	.devices     = 1,
+	.typed       = 1,
+	.rw          = 1,
+	.cpu         = 1,
+	.size_args   = {6, 4},
+	.params      = PARAM(PARAM_X) | PARAM(PARAM_Y) | PARAM(PARAM_PAD) | PARAM(PARAM_PAD_X) | PARAM(PARAM_HALO),
+	.defaults    = {[PARAM_X] = 5120, [PARAM_Y] = 5120},
+	.kernels     = standard_kernels + 1, // no R1W0
+	.num_kernels = 6,
+	.setup_point = blk2d_setup_point,
+	.set_args    = blk2d_set_args,
+	.index       = blk2d_index
+};
+
+static const family_t family_chblk2d = {
+	.name        = "chblk2d",
+	.description = "Channelized 2D overlapped blocking",
+	.dims        = 2,
+	.blocked     = 1,
+	.channelized = 1,
+	.devices     = 1,
+	.typed       = 1,
+	.rw          = 1,
+	.size_args   = {6, 4},
+	.params      = PARAM(PARAM_X) | PARAM(PARAM_Y) | PARAM(PARAM_PAD) | PARAM(PARAM_PAD_X) | PARAM(PARAM_HALO),
+	.defaults    = {[PARAM_X] = 5120, [PARAM_Y] = 5120},
+	.kernels     = standard_kernels + 1,
+	.num_kernels = 6,
+	.setup_point = blk2d_setup_point,
+	.set_args    = blk2d_set_args,
+	.index       = blk2d_index
+};
+
+#endif // FAMILY_BLK2D_H
@@ -0,0 +1,108 @@
+//====================================================================================================================================
+// 3D overlapped (2.5D) blocking kernels and their channelized version
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_BLK3D_H
+#define FAMILY_BLK3D_H
+
+#include "../common/bench.h"
+
+static inline void blk3d_setup_point(const bench_config_t* config, point_t* p)
+{
+	long valid_blk_x = config->block_x - 2 * p->halo;
+	long valid_blk_y = config->block_y - 2 * p->halo;
+
+	p->size_B = (long)p->dim_x * (long)p->dim_y * (long)p->dim_z * elem_size(config);
+	p->size_MiB = p->size_B / (1024 * 1024);
+	p->array_size = p->size_B / elem_size(config);
+	p->padded_array_size = p->pad + (long)p->dim_z * (p->pad_x + p->dim_x) * (p->pad_y + p->dim_y) + (long)(p->pad_y + p->dim_y) * (p->pad_x + p->dim_x) + (p->pad_x + p->dim_x);
+	p->dim = 3;
+
+	p->last_x = (p->dim_x % valid_blk_x == 0) ? p->dim_x : p->dim_x + valid_blk_x - (p->dim_x % valid_blk_x);
+	long last_y = (p->dim_y % valid_blk_y == 0) ? p->dim_y : p->dim_y + valid_blk_y - (p->dim_y % valid_blk_y);
+	long num_blk_x = p->last_x / valid_blk_x;
+	long num_blk_y = last_y / valid_blk_y;
+	long extra_halo_x = ((p->dim_x % valid_blk_x >= p->halo) || (p->dim_x % valid_blk_x == 0)) ? 0 : p->halo - (p->dim_x % valid_blk_x); // in case the halo width in the last block is not fully traversed
+	long extra_halo_y = ((p->dim_y % valid_blk_y >= p->halo) || (p->dim_y % valid_blk_y == 0)) ? 0 : p->halo - (p->dim_y % valid_blk_y); // in case the halo width in the last block is not fully traversed
+
+#ifdef INTEL_FPGA
+	p->localSize[2] = p->dim_z; // set like this to ensure the same index traversal ordering as the SWI kernel
+#else
+	p->localSize[2] = 1;        // set like this since the above case does not work on GPUs due to local work-group size limit
+#endif
+	p->localSize[0] = config->block_x / config->vec;
+	p->localSize[1] = config->block_y;
+	p->globalSize[0] = (config->block_x / config->vec) * num_blk_x;
+	p->globalSize[1] = config->block_y * num_blk_y;
+	p->globalSize[2] = p->dim_z;
+	p->loop_exit = (long)(config->block_x / config->vec) * num_blk_x * (long)config->block_y * num_blk_y * (long)p->dim_z;
+	p->total_B = ((num_blk_x * config->block_x) * (num_blk_y * config->block_y) - ((p->last_x + 2 * p->halo) * (last_y + 2 * p->halo) - ((p->dim_x - extra_halo_x) * (p->dim_y - extra_halo_y))) - (num_blk_x - 1 + num_blk_y - 1) * (2 * p->halo) * p->halo - ((p->last_x + p->halo + extra_halo_x - p->dim_x) * (num_blk_y - 1) + (last_y + p->halo + extra_halo_y - p->dim_y) * (num_blk_x - 1)) * 2 * p->halo) * p->dim_z * elem_size(config);
+}
+
+static inline void blk3d_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	cl_int last_x = p->last_x;
+
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad       ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad_x     ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad_y     ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->dim_x     ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->dim_y     ) );
+	if (!config->ndr)
+	{
+		CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->dim_z     ) );
+		CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &last_x       ) );
+		CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->loop_exit ) );
+	}
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->halo      ) );
+}
+
+static inline long blk3d_index(const point_t* p, long i)
+{
+	long z = i / ((long)p->dim_x * p->dim_y);
+	long y = (i / p->dim_x) % p->dim_y;
+	long x = i % p->dim_x;
+	return p->pad + z * (p->pad_x + p->dim_x) * (p->pad_y + p->dim_y) + (y + p->pad_y) * (p->pad_x + p->dim_x) + (p->pad_x + x);
+}
+
+static const family_t family_blk3d = {
+	.name        = "blk3d",
+	.description = "3D overlapped blocking",
+	.dims        = 3,
+	.blocked     = 2,
+	.channelized = 0,
+	.devices     = 1,
+	.typed       = 1,
+	.rw          = 1,
+	.cpu         = 1,
+	.size_args   = {9, 6},
+	.params      = PARAM(PARAM_X) | PARAM(PARAM_Y) | PARAM(PARAM_Z) | PARAM(PARAM_PAD) | PARAM(PARAM_PAD_X) | PARAM(PARAM_PAD_Y) | PARAM(PARAM_HALO),
+	.defaults    = {[PARAM_X] = 320, [PARAM_Y] = 320, [PARAM_Z] = 256},
+	.kernels     = standard_kernels + 1, // no R1W0
+	.num_kernels = 6,
+	.setup_point = blk3d_setup_point,
+	.set_args    = blk3d_set_args,
+	.index       = blk3d_index
+};
+
+static const family_t family_chblk3d = {
+	.name        = "chblk3d",
+	.description = "Channelized 3D overlapped blocking",
+	.dims        = 3,
+	.blocked     = 2,
+	.channelized = 1,
+	.devices     = 1,
+	.typed       = 1,
+	.rw          = 1,
+	.size_args   = {9, 6},
+	.params      = PARAM(PARAM_X) | PARAM(PARAM_Y) | PARAM(PARAM_Z) | PARAM(PARAM_PAD) | PARAM(PARAM_PAD_X) | PARAM(PARAM_PAD_Y) | PARAM(PARAM_HALO),
+	.defaults    = {[PARAM_X] = 320, [PARAM_Y] = 320, [PARAM_Z] = 256},
+	.kernels     = standard_kernels + 1,
+	.num_kernels = 6,
+	.setup_point = blk3d_setup_point,
+	.set_args    = blk3d_set_args,
+	.index       = blk3d_index
+};
+
+#endif // FAMILY_BLK3D_H
@@ -0,0 +1,111 @@
+//====================================================================================================================================
+// Pointer-chasing kernel: dependent loads over a random cyclic permutation of a working set, reporting the latency of one load
+// Buffer B holds the permutation and the kernel writes the last index it reaches to D
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_CHASE_H
+#define FAMILY_CHASE_H
+
+#include "../common/bench.h"
+
+#define CHASE_LOADS (1 << 20) // loads per run; small working sets are traversed many times, large ones only partly
+
+// bytes are those of the loads
+static const kernel_desc_t chase_kernels[] = {
+	{"CHASE", "BD", "B", "D", 0, 1, VERIFY_COPY, 0}
+};
+
+static inline void chase_setup_point(const bench_config_t* config, point_t* p)
+{
+	(void) config;
+
+	p->size_B = (long)p->size_KiB * 1024;
+	p->array_size = p->size_B / sizeof(int);
+	p->padded_array_size = p->array_size;
+	p->loop_exit = CHASE_LOADS;
+	p->accesses = CHASE_LOADS;
+	p->total_B = CHASE_LOADS * sizeof(int);
+}
+
+static inline void chase_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	(void) config;
+
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->loop_exit) );
+}
+
+static inline long chase_index(const point_t* p, long i)
+{
+	(void) p;
+	return i;
+}
+
+// Sattolo's algorithm, which only generates permutations made of a single cycle, so that the chase visits the whole working set
+// before it returns to the first index
+static inline void chase_fill_indexes(const bench_config_t* config, const point_t* p, int* index, int buffer)
+{
+	long n = p->array_size;
+	uint seed = 1 + buffer;
+	(void) config;
+
+	for (long i = 0; i < n; i++)
+	{
+		index[i] = i;
+	}
+	for (long i = n - 1; i > 0; i--)
+	{
+		long j = (long)(((unsigned long)rand_r(&seed) * ((unsigned long)RAND_MAX + 1) + rand_r(&seed)) % i);
+		int temp = index[i];
+		index[i] = index[j];
+		index[j] = temp;
+	}
+}
+
+// Follows the permutation on the host for the same number of loads
+static inline int chase_verify(const bench_t* bench, const kernel_desc_t* desc, const point_t* p, void* const* host, int verbose)
+{
+	const int* b = (const int*)host[1];
+	int obtained = ((const int*)host[3])[0];
+	int next = 0;
+	(void) bench;
+	(void) desc;
+
+	for (long i = 0; i < p->loop_exit; i++)
+	{
+		next = b[next];
+	}
+
+	if (obtained != next)
+	{
+		if (verbose) printf("Mismatch at index 0 of buffer D: Expected = %d, Obtained = %d\n", next, obtained);
+		return 0;
+	}
+	return 1;
+}
+
+// working sets from 4 KiB to 256 MiB are swept by default, from on-chip caches to well past the open pages of all DDR banks
+static const family_t family_chase = {
+	.name          = "chase",
+	.description   = "Pointer chase",
+	.dims          = 1,
+	.blocked       = 0,
+	.channelized   = 0,
+	.devices       = 1,
+	.single        = 1,
+	.latency       = 1,
+	.size_args     = {1, 1},
+	.params        = PARAM(PARAM_KIB),
+	.defaults      = {[PARAM_KIB] = 4},
+	.sweeps        = {[PARAM_KIB] = "4:262144:*4"},
+	.kernels       = chase_kernels,
+	.num_kernels   = 1,
+	.setup_point   = chase_setup_point,
+	.set_args      = chase_set_args,
+	.index         = chase_index,
+	.index_buffers = "B",
+	.fill_indexes  = chase_fill_indexes,
+	.verify        = chase_verify
+};
+
+#endif // FAMILY_CHASE_H
@@ -0,0 +1,111 @@
+//====================================================================================================================================
+// Channelized compute pipeline: a read kernel streams buffer A through a compute kernel that applies a chain of -fma dependent FMAs
+// to every element, to a write kernel that writes buffer D; the chain length sets the arithmetic intensity of the pipeline, at
+// 2 * fma FLOPs per element read and written
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_CHFMA_H
+#define FAMILY_CHFMA_H
+
+#include "../common/bench.h"
+
+#define CHFMA_WGS 64       // work-group size of the NDRange kernels
+#define CHFMA_CHAIN 16     // FMAs per element implemented by the compute kernel unless built with FMAS
+#define CHFMA_MUL 0.999f   // constants of every FMA, x = fma(x, CHFMA_MUL, CHFMA_ADD), same as in the kernel file
+#define CHFMA_ADD 0.001f
+
+// the compute kernel has no buffers; every element is read once and written once
+static const kernel_desc_t chfma_kernels[] = {
+	{"FMA", "AD", "A", "D", 1, 2, VERIFY_COPY, 0}
+};
+
+static inline void chfma_setup_point(const bench_config_t* config, point_t* p)
+{
+	// the largest chain length is checked first, before any point is run
+	if (p->fmas < 0 || p->fmas > config->fma_chain)
+	{
+		printf("Values of -fma must be between 0 and the %d FMAs per element of the kernel binary (FMAS)!\n", config->fma_chain);
+		exit(-1);
+	}
+
+	p->size_B = (long)p->size_MiB * 1024 * 1024;
+	p->array_size = p->size_B / elem_size(config);
+	p->padded_array_size = p->array_size + p->pad;
+	p->dim = 1;
+
+	check_work_groups(config, p->array_size, CHFMA_WGS);
+	p->groups = p->array_size / config->vec;
+	p->localSize[0] = CHFMA_WGS;
+	p->globalSize[0] = p->groups;
+	p->flops = 2 * (long)p->fmas * p->array_size;
+	p->total_B = p->size_B;
+}
+
+static inline void chfma_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	(void) config;
+
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad   ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->groups) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->fmas  ) );
+}
+
+static inline long chfma_index(const point_t* p, long i)
+{
+	return p->pad + i;
+}
+
+// Checks every output against its input with the FMAs of the sweep point applied in order; OpenCL rounds fma() once like fmaf(), so
+// the values match exactly
+static inline int chfma_verify(const bench_t* bench, const kernel_desc_t* desc, const point_t* p, void* const* host, int verbose)
+{
+	(void) bench;
+	(void) desc;
+
+	const float* a = (const float*)host[0];
+	const float* d = (const float*)host[3];
+	int fmas = p->fmas;
+	int success = 1;
+
+	#pragma omp parallel for default(none) firstprivate(p, a, d, fmas, verbose) shared(success)
+	for (long i = 0; i < p->array_size; i++)
+	{
+		long index = p->pad + i;
+		float expected = a[index];
+		for (int s = 0; s < fmas; s++)
+		{
+			expected = fmaf(expected, CHFMA_MUL, CHFMA_ADD);
+		}
+
+		if (d[index] != expected)
+		{
+			if (verbose) printf("Mismatch at index %ld of buffer D: Expected = %0.6f, Obtained = %0.6f\n", index, expected, d[index]);
+			success = 0;
+		}
+	}
+
+	return success;
+}
+
+static const family_t family_chfma = {
+	.name        = "chfma",
+	.description = "Channelized compute pipeline",
+	.dims        = 1,
+	.blocked     = 0,
+	.channelized = 1,
+	.compute     = 1,
+	.devices     = 1,
+	.wgs         = CHFMA_WGS,
+	.size_args   = {3, 3},
+	.params      = PARAM(PARAM_SIZE) | PARAM(PARAM_PAD) | PARAM(PARAM_FMA),
+	.defaults    = {[PARAM_SIZE] = 100},
+	.kernels     = chfma_kernels,
+	.num_kernels = 1,
+	.setup_point = chfma_setup_point,
+	.set_args    = chfma_set_args,
+	.index       = chfma_index,
+	.verify      = chfma_verify
+};
+
+#endif // FAMILY_CHFMA_H
@@ -0,0 +1,38 @@
+//====================================================================================================================================
+// Registry of all kernel families; new families are added to the table below
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILIES_H
+#define FAMILIES_H
+
+#include "std.h"
+#include "blk2d.h"
+#include "blk3d.h"
+#include "sch.h"
+#include "transfer.h"
+#include "stride.h"
+#include "gather.h"
+#include "chase.h"
+#include "mix.h"
+#include "layout.h"
+#include "transpose.h"
+#include "chfma.h"
+
+static const family_t* const families[] = {&family_std, &family_chstd, &family_blk2d, &family_chblk2d, &family_blk3d, &family_chblk3d, &family_sch, &family_transfer, &family_stride, &family_gather, &family_chase, &family_mix, &family_layout, &family_transpose, &family_chfma};
+#define NUM_FAMILIES ((int)(sizeof(families) / sizeof(families[0])))
+
+// Returns the index of the family with the given name in the table, or -1 if unknown
+static inline int find_family(const char* name)
+{
+	for (int i = 0; i < NUM_FAMILIES; i++)
+	{
+		if (strcmp(name, families[i]->name) == 0)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+#endif // FAMILIES_H
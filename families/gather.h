@@ -0,0 +1,190 @@
+//====================================================================================================================================
+// Gather/scatter kernels: data accessed through index buffers with configurable locality, generated by the host for every sweep
+// point; buffer B holds the gather indexes and C the scatter indexes
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_GATHER_H
+#define FAMILY_GATHER_H
+
+#include "../common/bench.h"
+
+#define GATHER_WGS 64 // work-group size of the NDRange kernels
+
+// bytes are those of the data, excluding the indexes
+static const kernel_desc_t gather_kernels[] = {
+	{"GATHER" , "ABD" , "AB" , "D", 0, 2, VERIFY_COPY, 0},
+	{"SCATTER", "ACD" , "AC" , "D", 0, 2, VERIFY_COPY, 0},
+	{"GS"     , "ABCD", "ABC", "D", 0, 2, VERIFY_COPY, 0}
+};
+
+static inline void gather_setup_point(const bench_config_t* config, point_t* p)
+{
+	p->size_B = (long)p->size_MiB * 1024 * 1024;
+	p->array_size = p->size_B / elem_size(config);
+	p->padded_array_size = p->array_size;
+	p->dim = 1;
+
+	check_work_groups(config, p->array_size, GATHER_WGS);
+	p->localSize[0] = GATHER_WGS;
+	p->globalSize[0] = p->array_size / config->vec;
+	p->loop_exit = p->array_size;
+	p->accesses = p->array_size;
+	p->total_B = p->size_B;
+}
+
+static inline void gather_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	if (!config->ndr) CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->loop_exit) );
+}
+
+static inline long gather_index(const point_t* p, long i)
+{
+	(void) p;
+	return i;
+}
+
+// Fills an index buffer for the given sweep point; gather and scatter indexes use different seeds, so that the gather-scatter
+// kernel moves data between two unrelated permutations
+static inline void gather_fill_indexes(const bench_config_t* config, const point_t* p, int* index, int buffer)
+{
+	long n = p->array_size;
+	long window = (long)p->window_KiB * 1024 / (long)elem_size(config);
+	window = (window > n) ? n : (window < 1) ? 1 : window;
+	uint seed = 1 + buffer;
+
+	for (long i = 0; i < n; i++)
+	{
+		index[i] = i;
+	}
+
+	if (config->locality == LOCALITY_RANDOM || config->locality == LOCALITY_BLOCK)
+	{
+		// Fisher-Yates shuffle of the whole array, or of every window
+		long length = (config->locality == LOCALITY_RANDOM) ? n : window;
+		#pragma omp parallel for default(none) firstprivate(n, length, seed, index) schedule(static)
+		for (long start = 0; start < n; start += length)
+		{
+			long end = (start + length < n) ? start + length : n;
+			uint local_seed = seed + start / length;
+			for (long i = end - 1; i > start; i--)
+			{
+				long j = start + (long)(((unsigned long)rand_r(&local_seed) * ((unsigned long)RAND_MAX + 1) + rand_r(&local_seed)) % (i - start + 1));
+				int temp = index[i];
+				index[i] = index[j];
+				index[j] = temp;
+			}
+		}
+	}
+	else if (config->locality == LOCALITY_JITTER)
+	{
+		// indexes sorted by their position plus a random offset smaller than the window; positions are first distributed into buckets
+		// of one window of sort keys in position order, then every bucket is sorted with a counting sort, which keeps ties in order
+		long num_buckets = (n + window - 1) / window + 1;
+		int* offset = (int*)malloc(n * sizeof(int));
+		int* order = (int*)malloc(n * sizeof(int));
+		long* first = (long*)calloc(num_buckets + 1, sizeof(long));
+		if (offset == NULL || order == NULL || first == NULL)
+		{
+			printf("ERROR: malloc(offset) failed.\n");
+			exit(-1);
+		}
+		for (long i = 0; i < n; i++)
+		{
+			offset[i] = rand_r(&seed) % window;
+			first[(i + offset[i]) / window + 1]++;
+		}
+		for (long b = 0; b < num_buckets; b++)
+		{
+			first[b + 1] += first[b];
+		}
+		for (long i = 0; i < n; i++)
+		{
+			order[first[(i + offset[i]) / window]++] = i;
+		}
+
+		// first[b] is now the end of bucket b
+		#pragma omp parallel default(none) firstprivate(num_buckets, window, offset, order, first, index)
+		{
+			long* count = (long*)malloc(window * sizeof(long));
+			#pragma omp for schedule(dynamic, 16)
+			for (long b = 0; b < num_buckets; b++)
+			{
+				long start = (b == 0) ? 0 : first[b - 1];
+				memset(count, 0, window * sizeof(long));
+				for (long k = start; k < first[b]; k++)
+				{
+					count[order[k] + offset[order[k]] - b * window]++;
+				}
+				for (long key = 0, position = start; key < window; key++)
+				{
+					long temp = count[key];
+					count[key] = position;
+					position += temp;
+				}
+				for (long k = start; k < first[b]; k++)
+				{
+					index[count[order[k] + offset[order[k]] - b * window]++] = order[k];
+				}
+			}
+			free(count);
+		}
+		free(offset);
+		free(order);
+		free(first);
+	}
+}
+
+// Checks d[C[i]] = A[B[i]], with B or C being the identity for gather and scatter
+static inline int gather_verify(const bench_t* bench, const kernel_desc_t* desc, const point_t* p, void* const* host, int verbose)
+{
+	const int* gather = (strchr(desc->buffers, 'B') != NULL) ? (const int*)host[1] : NULL;
+	const int* scatter = (strchr(desc->buffers, 'C') != NULL) ? (const int*)host[2] : NULL;
+	const void* a = host[0];
+	const void* d = host[3];
+	int dtype = bench->config.dtype, lanes = dtype_lanes[dtype];
+	int success = 1;
+
+	#pragma omp parallel for default(none) firstprivate(p, gather, scatter, a, d, dtype, lanes, verbose) shared(success)
+	for (long i = 0; i < p->array_size; i++)
+	{
+		long in = (gather != NULL) ? gather[i] : i;
+		long out = (scatter != NULL) ? scatter[i] : i;
+		for (int l = 0; l < lanes; l++)
+		{
+			double expected = dtype_get(a, dtype, in * lanes + l);
+			double obtained = dtype_get(d, dtype, out * lanes + l);
+			if (obtained != expected)
+			{
+				if (verbose) printf("Mismatch at index %ld of buffer D: Expected = %0.6f, Obtained = %0.6f\n", out, expected, obtained);
+				success = 0;
+			}
+		}
+	}
+
+	return success;
+}
+
+static const family_t family_gather = {
+	.name          = "gather",
+	.description   = "Gather/scatter",
+	.dims          = 1,
+	.blocked       = 0,
+	.channelized   = 0,
+	.devices       = 1,
+	.typed         = 1,
+	.wgs           = GATHER_WGS,
+	.size_args     = {1, 0},
+	.params        = PARAM(PARAM_SIZE) | PARAM(PARAM_WINDOW),
+	.defaults      = {[PARAM_SIZE] = 100, [PARAM_WINDOW] = 64},
+	.kernels       = gather_kernels,
+	.num_kernels   = 3,
+	.setup_point   = gather_setup_point,
+	.set_args      = gather_set_args,
+	.index         = gather_index,
+	.index_buffers = "BC",
+	.fill_indexes  = gather_fill_indexes,
+	.verify        = gather_verify
+};
+
+#endif // FAMILY_GATHER_H
@@ -0,0 +1,130 @@
+//====================================================================================================================================
+// Record layouts: records of a fixed number of fields stored in buffer A as one array per field (SoA), whole records one after the
+// other (AoS) or one array per field in every tile of records (AoSoA); every kernel writes the sum of the fields of each record to D
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_LAYOUT_H
+#define FAMILY_LAYOUT_H
+
+#include "../common/bench.h"
+
+#define LAYOUT_WGS 64 // work-group size of the NDRange kernels
+
+// in the order of the layouts of the kernel file; bytes are one access per field and one per sum, see layout_setup_point
+static const kernel_desc_t layout_kernels[] = {
+	{"SOA"  , "AD", "A", "D", 0, 0, VERIFY_SUM, 0},
+	{"AOS"  , "AD", "A", "D", 0, 0, VERIFY_SUM, 0},
+	{"AOSOA", "AD", "A", "D", 0, 0, VERIFY_SUM, 0}
+};
+enum {LAYOUT_SOA, LAYOUT_AOS, LAYOUT_AOSOA};
+
+// Buffer A holds as many whole records as fit in the buffer size, rounded down to whole work-groups and tiles, and D holds one
+// sum per record; the bytes of a run are those of R<fields>W1 over arrays of one field, so both size_B and total_B are the bytes
+// of one field of all records
+static inline void layout_setup_point(const bench_config_t* config, point_t* p)
+{
+	long unit = (long)config->vec * LAYOUT_WGS;
+
+	if (p->tile < config->vec || (p->tile & (p->tile - 1)) != 0 || p->tile % config->vec != 0)
+	{
+		printf("Tile size must be a power of two and a multiple of the vector size!\n");
+		exit(-1);
+	}
+
+	p->padded_array_size = (long)p->size_MiB * 1024 * 1024 / elem_size(config);
+	p->array_size = p->padded_array_size / config->fields;
+	p->array_size -= p->array_size % unit;
+	p->array_size -= p->array_size % p->tile;
+	if (p->array_size == 0)
+	{
+		printf("Buffer size must be large enough for one work-group and one tile of records!\n");
+		exit(-1);
+	}
+	p->dim = 1;
+
+	p->localSize[0] = LAYOUT_WGS;
+	p->globalSize[0] = p->array_size / config->vec;
+	p->reads = config->fields;
+	p->writes = 1;
+	p->size_B = p->array_size * elem_size(config);
+	p->total_B = p->size_B;
+}
+
+static inline void layout_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	(void) config;
+
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->array_size) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->tile      ) );
+}
+
+static inline long layout_index(const point_t* p, long i)
+{
+	(void) p;
+	return i;
+}
+
+// Location of field f of record r in buffer A
+static inline long layout_field(int layout, const bench_config_t* config, const point_t* p, long r, int f)
+{
+	return (layout == LAYOUT_SOA) ? f * p->array_size + r :
+	       (layout == LAYOUT_AOS) ? r * config->fields + f :
+	       (r - r % p->tile) * config->fields + f * p->tile + r % p->tile;
+}
+
+// Checks every sum against the fields of its record, added in the same order as R3W1 adds its inputs
+static inline int layout_verify(const bench_t* bench, const kernel_desc_t* desc, const point_t* p, void* const* host, int verbose)
+{
+	const bench_config_t* config = &bench->config;
+	int layout = desc - layout_kernels;
+	int dtype = config->dtype, lanes = dtype_lanes[dtype];
+	const void* a = host[0];
+	const void* d = host[3];
+	int success = 1;
+
+	#pragma omp parallel for default(none) firstprivate(config, layout, p, a, d, dtype, lanes, verbose) shared(success)
+	for (long r = 0; r < p->array_size; r++)
+	{
+		for (int l = 0; l < lanes; l++)
+		{
+			double expected = 0;
+			for (int f = 0; f < config->fields; f++)
+			{
+				expected = dtype_round(dtype, expected + dtype_get(a, dtype, layout_field(layout, config, p, r, f) * lanes + l));
+			}
+
+			double obtained = dtype_get(d, dtype, r * lanes + l);
+			if (fabs(obtained - expected) > 0.001)
+			{
+				if (verbose) printf("Mismatch at index %ld of buffer D: Expected = %0.6f, Obtained = %0.6f\n", r, expected, obtained);
+				success = 0;
+			}
+		}
+	}
+
+	return success;
+}
+
+static const family_t family_layout = {
+	.name        = "layout",
+	.description = "Record layout",
+	.dims        = 1,
+	.blocked     = 0,
+	.channelized = 0,
+	.devices     = 1,
+	.typed       = 1,
+	.fields      = 3,
+	.wgs         = LAYOUT_WGS,
+	.size_args   = {2, 2},
+	.params      = PARAM(PARAM_SIZE) | PARAM(PARAM_TILE),
+	.defaults    = {[PARAM_SIZE] = 100, [PARAM_TILE] = 16},
+	.kernels     = layout_kernels,
+	.num_kernels = 3,
+	.setup_point = layout_setup_point,
+	.set_args    = layout_set_args,
+	.index       = layout_index,
+	.verify      = layout_verify
+};
+
+#endif // FAMILY_LAYOUT_H
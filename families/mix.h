@@ -0,0 +1,116 @@
+//====================================================================================================================================
+// Read/write mix kernel: every index is read from "reads" buffers and written to "writes" buffers, selected at run time out of
+// buffers A to H, so that the read/write ratio can be swept with a single kernel binary
+// The inputs are the first buffers and the outputs follow them; like all other buffers, they alternate between the memory banks
+// when interleaving is disabled
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_MIX_H
+#define FAMILY_MIX_H
+
+#include "../common/bench.h"
+
+#define MIX_WGS     64 // work-group size of the NDRange kernel
+#define MIX_BUFFERS 8
+
+// every buffer is an input at some sweep points and an output at others; bytes follow from the reads and writes of the point
+static const kernel_desc_t mix_kernels[] = {
+	{"MIX", "ABCDEFGH", "ABCDEFGH", "ABCDEFGH", 0, 0, VERIFY_SUM, 0}
+};
+
+static inline void mix_setup_point(const bench_config_t* config, point_t* p)
+{
+	// the largest values of both parameters are checked together first, before any point is run
+	if (p->reads < 0 || p->writes < 1 || p->reads + p->writes > MIX_BUFFERS)
+	{
+		printf("Values of -reads and -writes must be at least 0 and 1, and their largest values must add up to at most %d!\n", MIX_BUFFERS);
+		exit(-1);
+	}
+
+	p->size_B = (long)p->size_MiB * 1024 * 1024;
+	p->array_size = p->size_B / elem_size(config);
+	p->padded_array_size = p->array_size + p->pad;
+	p->dim = 1;
+
+	check_work_groups(config, p->array_size, MIX_WGS);
+	p->groups = p->array_size / config->vec;
+	p->localSize[0] = MIX_WGS;
+	p->globalSize[0] = p->groups;
+	p->total_B = p->size_B;
+}
+
+static inline void mix_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	(void) config;
+
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad   ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->groups) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->reads ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->writes) );
+}
+
+static inline long mix_index(const point_t* p, long i)
+{
+	return p->pad + i;
+}
+
+// Checks every output of the sweep point against the sum of its inputs, or the fill value if there are none
+static inline int mix_verify(const bench_t* bench, const kernel_desc_t* desc, const point_t* p, void* const* host, int verbose)
+{
+	int reads = p->reads, writes = p->writes;
+	int dtype = bench->config.dtype, lanes = dtype_lanes[dtype];
+	int success = 1;
+	(void) desc;
+
+	#pragma omp parallel for default(none) firstprivate(p, host, reads, writes, dtype, lanes, verbose) shared(success)
+	for (long i = 0; i < p->array_size; i++)
+	{
+		long index = mix_index(p, i);
+
+		for (long s = index * lanes; s < (index + 1) * lanes; s++)
+		{
+			double expected = (reads > 0) ? 0 : FILL_VALUE;
+
+			for (int b = 0; b < reads; b++)
+			{
+				expected = dtype_round(dtype, expected + dtype_get(host[b], dtype, s));
+			}
+			for (int b = reads; b < reads + writes; b++)
+			{
+				double obtained = dtype_get(host[b], dtype, s);
+				if (fabs(obtained - expected) > 0.001)
+				{
+					if (verbose) printf("Mismatch at index %ld of buffer %c: Expected = %0.6f, Obtained = %0.6f\n", index, 'A' + b, expected, obtained);
+					success = 0;
+				}
+			}
+		}
+	}
+
+	return success;
+}
+
+// read/write ratios from 1:4 to 4:1 are swept by default
+static const family_t family_mix = {
+	.name        = "mix",
+	.description = "Read/write mix",
+	.dims        = 1,
+	.blocked     = 0,
+	.channelized = 0,
+	.devices     = 1,
+	.typed       = 1,
+	.wgs         = MIX_WGS,
+	.size_args   = {4, 4},
+	.params      = PARAM(PARAM_SIZE) | PARAM(PARAM_PAD) | PARAM(PARAM_READS) | PARAM(PARAM_WRITES),
+	.defaults    = {[PARAM_SIZE] = 100},
+	.sweeps      = {[PARAM_READS] = "1:4", [PARAM_WRITES] = "1:4"},
+	.kernels     = mix_kernels,
+	.num_kernels = 1,
+	.setup_point = mix_setup_point,
+	.set_args    = mix_set_args,
+	.index       = mix_index,
+	.verify      = mix_verify
+};
+
+#endif // FAMILY_MIX_H
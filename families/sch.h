@@ -0,0 +1,180 @@
+//====================================================================================================================================
+// Serial channel kernels for the Nallatech 510T board: one FPGA reads a buffer and sends it to the other one, which writes it back,
+// or all FPGAs do both at the same time, or a pair of FPGAs bounces messages to measure the latency of the link
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_SCH_H
+#define FAMILY_SCH_H
+
+#include "../common/bench.h"
+
+#define SCH_WGS 64 // work-group size of the NDRange kernels
+
+// bytes are those sent over the channel
+static const kernel_desc_t sch_kernels[] = {
+	{"R1W1", "AD", "A", "D", 1, 1, VERIFY_COPY, 0}
+};
+
+static inline void sch_setup_point(const bench_config_t* config, point_t* p)
+{
+	p->size_B = (long)p->size_MiB * 1024 * 1024;
+	p->array_size = p->size_B / elem_size(config);
+	p->padded_array_size = p->array_size + p->pad;
+	p->dim = 1;
+
+	p->localSize[0] = SCH_WGS;
+	p->globalSize[0] = p->array_size / config->vec;
+	p->total_B = p->size_B;
+}
+
+static inline void sch_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad       ) );
+	if (!config->ndr) CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->array_size) );
+}
+
+static inline long sch_index(const point_t* p, long i)
+{
+	return p->pad + i;
+}
+
+// Topologies of the serial channel, each with kernel binaries of its own, named after the flag they are built with
+enum {TOPOLOGY_ONEWAY, TOPOLOGY_DUPLEX, TOPOLOGY_RING, TOPOLOGY_PINGPONG, NUM_TOPOLOGIES};
+static const char* const topology_names[NUM_TOPOLOGIES] = {"oneway", "duplex", "ring", "pingpong"};
+static const char* const topology_flags[NUM_TOPOLOGIES] = {NULL, "DUPLEX", "RING", "PINGPONG"};
+
+// Returns the index of the given topology name, or -1 if unknown
+inline static int parse_topology(const char* name)
+{
+	for (int i = 0; i < NUM_TOPOLOGIES; i++)
+	{
+		if (strcmp(name, topology_names[i]) == 0)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+// every message is one channel word, i.e. half a vector, and makes two hops
+static const kernel_desc_t sch_pingpong_kernels[] = {
+	{"PINGPONG", "A", "A", "", 1, 1, VERIFY_NONE, 0}
+};
+
+static inline void sch_pingpong_setup_point(const bench_config_t* config, point_t* p)
+{
+	long word = config->vec / 2 * elem_size(config);
+
+	if (config->vec < 2 || (long)p->size_KiB * 1024 < word)
+	{
+		printf("Ping-pong needs a vector size of at least 2 and room for one message!\n");
+		exit(-1);
+	}
+
+	p->size_B = (long)p->size_KiB * 1024 / word * word;
+	p->array_size = p->size_B / elem_size(config);
+	p->padded_array_size = p->array_size;
+	p->accesses = 2 * p->size_B / word;
+	p->total_B = p->size_B;
+}
+
+static inline void sch_pingpong_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	(void) config;
+
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->array_size) );
+}
+
+static const family_t family_sch = {
+	.name        = "sch",
+	.description = "Nallatech 510T serial channel",
+	.dims        = 1,
+	.blocked     = 0,
+	.channelized = 1,
+	.devices     = 2,
+	.typed       = 1,
+	.channel     = 1,
+	.wgs         = SCH_WGS,
+	.size_args   = {2, 1},
+	.params      = PARAM(PARAM_SIZE) | PARAM(PARAM_PAD),
+	.defaults    = {[PARAM_SIZE] = 100},
+	.kernels     = sch_kernels,
+	.num_kernels = 1,
+	.setup_point = sch_setup_point,
+	.set_args    = sch_set_args,
+	.index       = sch_index,
+	.topology    = "oneway"
+};
+
+// Every FPGA of a pair runs both kernels, and receives the buffer of the other one
+static const family_t family_sch_duplex = {
+	.name        = "sch",
+	.description = "Nallatech 510T serial channel, full duplex",
+	.dims        = 1,
+	.blocked     = 0,
+	.channelized = 1,
+	.devices     = 1,
+	.spread      = 2,
+	.typed       = 1,
+	.channel     = 1,
+	.wgs         = SCH_WGS,
+	.size_args   = {2, 1},
+	.params      = PARAM(PARAM_SIZE) | PARAM(PARAM_PAD),
+	.defaults    = {[PARAM_SIZE] = 100},
+	.kernels     = sch_kernels,
+	.num_kernels = 1,
+	.setup_point = sch_setup_point,
+	.set_args    = sch_set_args,
+	.index       = sch_index,
+	.topology    = "duplex"
+};
+
+// Every FPGA of the ring runs both kernels, and receives half of the buffer of each neighbour
+static const family_t family_sch_ring = {
+	.name        = "sch",
+	.description = "Nallatech 510T serial channel, ring",
+	.dims        = 1,
+	.blocked     = 0,
+	.channelized = 1,
+	.devices     = 1,
+	.spread      = 3,
+	.typed       = 1,
+	.channel     = 1,
+	.wgs         = SCH_WGS,
+	.size_args   = {2, 1},
+	.params      = PARAM(PARAM_SIZE) | PARAM(PARAM_PAD),
+	.defaults    = {[PARAM_SIZE] = 100},
+	.kernels     = sch_kernels,
+	.num_kernels = 1,
+	.setup_point = sch_setup_point,
+	.set_args    = sch_set_args,
+	.index       = sch_index,
+	.topology    = "ring"
+};
+
+// the data of the messages fills a buffer of the given size; the latency is reported per hop, i.e. half a round trip
+static const family_t family_sch_pingpong = {
+	.name        = "sch",
+	.description = "Nallatech 510T serial channel, ping-pong",
+	.dims        = 1,
+	.blocked     = 0,
+	.channelized = 1,
+	.devices     = 2,
+	.single      = 1,
+	.latency     = 1,
+	.typed       = 1,
+	.size_args   = {1, 1},
+	.params      = PARAM(PARAM_KIB),
+	.defaults    = {[PARAM_KIB] = 64},
+	.kernels     = sch_pingpong_kernels,
+	.num_kernels = 1,
+	.setup_point = sch_pingpong_setup_point,
+	.set_args    = sch_pingpong_set_args,
+	.index       = sch_index,
+	.topology    = "pingpong"
+};
+
+static const family_t* const sch_topologies[NUM_TOPOLOGIES] = {&family_sch, &family_sch_duplex, &family_sch_ring, &family_sch_pingpong};
+
+#endif // FAMILY_SCH_H
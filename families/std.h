@@ -0,0 +1,82 @@
+//====================================================================================================================================
+// Standard (1D blocking) kernels and their channelized version
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_STD_H
+#define FAMILY_STD_H
+
+#include "../common/bench.h"
+
+static inline void std_setup_point(const bench_config_t* config, point_t* p)
+{
+	long valid_blk_x = config->block_x - 2 * p->halo;
+
+	p->size_B = (long)p->size_MiB * 1024 * 1024;
+	p->array_size = p->size_B / elem_size(config);
+	p->padded_array_size = p->array_size + p->pad;
+	p->dim = 1;
+
+	p->last_x = (p->array_size % valid_blk_x == 0) ? p->array_size : p->array_size + valid_blk_x - (p->array_size % valid_blk_x);
+	long num_blk_x = p->last_x / valid_blk_x;
+	long extra_halo_x = ((p->array_size % valid_blk_x >= p->halo) || (p->array_size % valid_blk_x == 0)) ? 0 : p->halo - (p->array_size % valid_blk_x); // in case the halo width in the last block is not fully traversed
+
+	p->localSize[0] = config->block_x / config->vec;
+	p->globalSize[0] = (config->block_x / config->vec) * num_blk_x;
+	p->loop_exit = (long)(config->block_x / config->vec) * num_blk_x;
+	p->total_B = ((num_blk_x * config->block_x) - (p->last_x + 2 * p->halo - p->array_size) - extra_halo_x) * elem_size(config);
+}
+
+static inline void std_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad       ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->array_size) );
+	if (!config->ndr) CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->loop_exit ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->halo      ) );
+}
+
+static inline long std_index(const point_t* p, long i)
+{
+	return p->pad + i;
+}
+
+static const family_t family_std = {
+	.name        = "std",
+	.description = "Standard",
+	.dims        = 1,
+	.blocked     = 1,
+	.channelized = 0,
+	.devices     = 1,
+	.typed       = 1,
+	.rw          = 1,
+	.cpu         = 1,
+	.size_args   = {4, 3},
+	.params      = PARAM(PARAM_SIZE) | PARAM(PARAM_PAD) | PARAM(PARAM_HALO),
+	.defaults    = {[PARAM_SIZE] = 100},
+	.kernels     = standard_kernels,
+	.num_kernels = 7,
+	.setup_point = std_setup_point,
+	.set_args    = std_set_args,
+	.index       = std_index
+};
+
+static const family_t family_chstd = {
+	.name        = "chstd",
+	.description = "Channelized standard",
+	.dims        = 1,
+	.blocked     = 1,
+	.channelized = 1,
+	.devices     = 1,
+	.typed       = 1,
+	.rw          = 1,
+	.size_args   = {4, 3},
+	.params      = PARAM(PARAM_SIZE) | PARAM(PARAM_PAD) | PARAM(PARAM_HALO),
+	.defaults    = {[PARAM_SIZE] = 100},
+	.kernels     = standard_kernels,
+	.num_kernels = 7,
+	.setup_point = std_setup_point,
+	.set_args    = std_set_args,
+	.index       = std_index
+};
+
+#endif // FAMILY_STD_H
@@ -0,0 +1,70 @@
+//====================================================================================================================================
+// Strided kernels: groups of VEC consecutive indexes accessed "stride" groups apart, in as many passes as the stride
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_STRIDE_H
+#define FAMILY_STRIDE_H
+
+#include "../common/bench.h"
+
+#define STRIDE_WGS 64 // work-group size of the NDRange kernels
+
+static inline void stride_setup_point(const bench_config_t* config, point_t* p)
+{
+	p->size_B = (long)p->size_MiB * 1024 * 1024;
+	p->array_size = p->size_B / elem_size(config);
+	p->padded_array_size = p->array_size + p->pad;
+	p->dim = 2;
+
+	// the last work-group of a pass is rounded up and masked by the kernels, so that only whole vectors are needed
+	check_work_groups(config, p->array_size, 1);
+
+	// one row of the traversal is one access of every pass
+	p->groups = p->array_size / config->vec;
+	p->rows = (p->groups + p->stride - 1) / p->stride;
+
+	p->localSize[0] = STRIDE_WGS;
+	p->localSize[1] = 1;
+	p->globalSize[0] = (p->rows + STRIDE_WGS - 1) / STRIDE_WGS * STRIDE_WGS;
+	p->globalSize[1] = p->stride;
+	p->loop_exit = p->rows * p->stride;
+	p->total_B = p->size_B;
+}
+
+static inline void stride_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad      ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->groups   ) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->rows     ) );
+	if (!config->ndr) CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_long ), (void*) &p->loop_exit) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->stride   ) );
+}
+
+static inline long stride_index(const point_t* p, long i)
+{
+	return p->pad + i;
+}
+
+// strides up to 4096 groups are swept by default, which is past the DDR page size even for VEC = 1
+static const family_t family_stride = {
+	.name        = "stride",
+	.description = "Strided",
+	.dims        = 1,
+	.blocked     = 0,
+	.channelized = 0,
+	.devices     = 1,
+	.typed       = 1,
+	.wgs         = STRIDE_WGS,
+	.size_args   = {5, 4},
+	.params      = PARAM(PARAM_SIZE) | PARAM(PARAM_PAD) | PARAM(PARAM_STRIDE),
+	.defaults    = {[PARAM_SIZE] = 100, [PARAM_STRIDE] = 1},
+	.sweeps      = {[PARAM_STRIDE] = "1:4096:*2"},
+	.kernels     = standard_kernels,
+	.num_kernels = 3,
+	.setup_point = stride_setup_point,
+	.set_args    = stride_set_args,
+	.index       = stride_index
+};
+
+#endif // FAMILY_STRIDE_H
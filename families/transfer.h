@@ -0,0 +1,140 @@
+//====================================================================================================================================
+// Host-device transfers: host to device, device to host and both directions at once in two queues, with blocking and non-blocking
+// reads and writes or map/unmap, optionally split into chunks
+// Buffer A is the host source and C the device destination of host to device transfers, B is the device source and D the host
+// destination of device to host transfers
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_TRANSFER_H
+#define FAMILY_TRANSFER_H
+
+#include "../common/bench.h"
+
+// Transfer methods
+enum {XFER_BLOCKING, XFER_NONBLOCKING, XFER_MAP};
+
+static const kernel_desc_t transfer_kernels[] = {
+	{"H2D"    , "AC"  , "A" , "C" , 0, 1, VERIFY_COPY, 0},
+	{"H2D_NB" , "AC"  , "A" , "C" , 0, 1, VERIFY_COPY, 0},
+	{"H2D_MAP", "AC"  , "A" , "C" , 0, 1, VERIFY_COPY, 0},
+	{"D2H"    , "BD"  , "B" , "D" , 0, 1, VERIFY_COPY, 0},
+	{"D2H_NB" , "BD"  , "B" , "D" , 0, 1, VERIFY_COPY, 0},
+	{"D2H_MAP", "BD"  , "B" , "D" , 0, 1, VERIFY_COPY, 0},
+	{"BIDIR"  , "ABCD", "AB", "CD", 0, 2, VERIFY_COPY, 0}
+};
+
+// directions and method of every kernel above
+static const int transfer_ops[][3] = {
+	// h2d, d2h, method
+	{1, 0, XFER_BLOCKING   },
+	{1, 0, XFER_NONBLOCKING},
+	{1, 0, XFER_MAP        },
+	{0, 1, XFER_BLOCKING   },
+	{0, 1, XFER_NONBLOCKING},
+	{0, 1, XFER_MAP        },
+	{1, 1, XFER_NONBLOCKING}
+};
+
+static inline void transfer_setup_point(const bench_config_t* config, point_t* p)
+{
+	(void) config;
+
+	p->size_B = (long)p->size_KiB * 1024;
+	p->array_size = p->size_B / sizeof(float);
+	p->padded_array_size = p->array_size;
+	p->total_B = p->size_B;
+}
+
+static inline long transfer_index(const point_t* p, long i)
+{
+	(void) p;
+	return i;
+}
+
+// Enqueues the chunks of one direction in the given queue; only the events of the first and last command are returned, since
+// together they span the whole transfer
+static inline void transfer_enqueue(cl_command_queue queue, int h2d, int method, cl_mem device, float* host, const point_t* p, cl_event* event)
+{
+	long chunk_B = (p->chunk_KiB == 0 || (long)p->chunk_KiB * 1024 > p->size_B) ? p->size_B : (long)p->chunk_KiB * 1024;
+	cl_int error;
+
+	for (long offset = 0; offset < p->size_B; offset += chunk_B)
+	{
+		long size = (p->size_B - offset < chunk_B) ? p->size_B - offset : chunk_B;
+		char* ptr = (char*)host + offset;
+		cl_event* first = (event != NULL && offset == 0) ? &event[0] : NULL;
+		cl_event* last = (event != NULL && offset + size >= p->size_B) ? &event[1] : NULL;
+
+		if (method == XFER_MAP)
+		{
+			void* mapped = clEnqueueMapBuffer(queue, device, CL_TRUE, h2d ? CL_MAP_WRITE_INVALIDATE_REGION : CL_MAP_READ, offset, size, 0, NULL, first, &error);
+			if(error != CL_SUCCESS) { printf("ERROR: clEnqueueMapBuffer failed with error: "); display_error_message(error, stdout); exit(-1);}
+			if (h2d) memcpy(mapped, ptr, size); else memcpy(ptr, mapped, size);
+			CL_SAFE_CALL( clEnqueueUnmapMemObject(queue, device, mapped, 0, NULL, last) );
+			continue;
+		}
+
+		// a single-chunk transfer has one event that is both the first and the last
+		cl_event chunk_event;
+		cl_event* chunk = (first != NULL || last != NULL) ? &chunk_event : NULL;
+		cl_bool blocking = (method == XFER_BLOCKING) ? CL_TRUE : CL_FALSE;
+		if (h2d)
+		{
+			CL_SAFE_CALL( clEnqueueWriteBuffer(queue, device, blocking, offset, size, ptr, 0, NULL, chunk) );
+		}
+		else
+		{
+			CL_SAFE_CALL( clEnqueueReadBuffer(queue, device, blocking, offset, size, ptr, 0, NULL, chunk) );
+		}
+		if (first != NULL) *first = chunk_event;
+		if (last != NULL)
+		{
+			if (first != NULL) clRetainEvent(chunk_event);
+			*last = chunk_event;
+		}
+	}
+}
+
+// Runs host to device transfers in the first queue and device to host transfers in the second one, so that both directions
+// overlap in the bidirectional kernel
+static inline int transfer_run(const bench_t* bench, const bench_kernel_t* kernel, const point_t* p, cl_event* event)
+{
+	const int* op = transfer_ops[kernel->desc - transfer_kernels];
+	const buffer_set_t* set = kernel->set;
+	int count = 0;
+
+	if (op[0])
+	{
+		transfer_enqueue(bench->queue[0], 1, op[2], set->device[2], set->host[0], p, (event == NULL) ? NULL : &event[count]);
+		count += 2;
+	}
+	if (op[1])
+	{
+		transfer_enqueue(bench->queue[1], 0, op[2], set->device[1], set->host[3], p, (event == NULL) ? NULL : &event[count]);
+		count += 2;
+	}
+	clFinish(bench->queue[0]);
+	clFinish(bench->queue[1]);
+
+	return count;
+}
+
+static const family_t family_transfer = {
+	.name        = "transfer",
+	.description = "Host-device transfer",
+	.dims        = 1,
+	.blocked     = 0,
+	.channelized = 0,
+	.devices     = 1,
+	.transfer    = 1,
+	.params      = PARAM(PARAM_KIB) | PARAM(PARAM_CHUNK),
+	.sweeps      = {[PARAM_KIB] = "4:4194304:*2"},
+	.kernels     = transfer_kernels,
+	.num_kernels = 7,
+	.setup_point = transfer_setup_point,
+	.index       = transfer_index,
+	.run         = transfer_run
+};
+
+#endif // FAMILY_TRANSFER_H
@@ -0,0 +1,115 @@
+//====================================================================================================================================
+// Transpose kernels: a row-major copy, a direct transpose with column-major writes and a transpose through a local-memory tile of
+// tile_size x tile_size elements; the transposed matrix has dim_x rows of dim_y elements
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef FAMILY_TRANSPOSE_H
+#define FAMILY_TRANSPOSE_H
+
+#include "../common/bench.h"
+
+#define TRANSPOSE_TILE 64 // elements per side of the tile unless built with TILE; 16 KiB of float, within the local memory of any GPU
+
+// in the order of the kernel file; every element is read once and written once
+static const kernel_desc_t transpose_kernels[] = {
+	{"COPY"     , "AD", "A", "D", 0, 2, VERIFY_COPY, 0},
+	{"TRANSPOSE", "AD", "A", "D", 0, 2, VERIFY_COPY, 0},
+	{"TILED"    , "AD", "A", "D", 0, 2, VERIFY_COPY, 0}
+};
+
+// Both dimensions are whole tiles, which are also the traversal unit of the copy and direct transpose; row padding is added to the
+// rows of the input and of the transposed output alike, so that it can move the column-major writes away from power-of-two strides
+static inline void transpose_setup_point(const bench_config_t* config, point_t* p)
+{
+	if (p->dim_x % config->tile_size != 0 || p->dim_y % config->tile_size != 0)
+	{
+		printf("X and Y dimension sizes must be multiples of the tile size!\n");
+		exit(-1);
+	}
+
+	long rows = (long)p->dim_y * (p->dim_x + p->pad_x);
+	long columns = (long)p->dim_x * (p->dim_y + p->pad_x);
+
+	p->size_B = (long)p->dim_x * (long)p->dim_y * elem_size(config);
+	p->size_MiB = p->size_B / (1024 * 1024);
+	p->array_size = (long)p->dim_x * (long)p->dim_y;
+	p->padded_array_size = (rows > columns) ? rows : columns;
+	p->dim = 2;
+
+	p->localSize[0] = config->tile_size / config->vec;
+	p->localSize[1] = 1;
+	p->globalSize[0] = p->dim_x / config->vec;
+	p->globalSize[1] = p->dim_y / config->tile_size;
+	p->total_B = p->size_B;
+}
+
+static inline void transpose_set_args(cl_kernel kernel, cl_uint arg, const bench_config_t* config, const point_t* p)
+{
+	(void) config;
+
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->dim_x) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->dim_y) );
+	CL_SAFE_CALL( clSetKernelArg(kernel, arg++, sizeof(cl_int  ), (void*) &p->pad_x) );
+}
+
+static inline long transpose_index(const point_t* p, long i)
+{
+	long y = i / p->dim_x;
+	long x = i % p->dim_x;
+	return y * (p->dim_x + p->pad_x) + x;
+}
+
+// Checks every element of the output against the input element at the same position, or at the transposed position
+static inline int transpose_verify(const bench_t* bench, const kernel_desc_t* desc, const point_t* p, void* const* host, int verbose)
+{
+	int transposed = (strcmp(desc->name, "COPY") != 0);
+	int dtype = bench->config.dtype, lanes = dtype_lanes[dtype];
+	const void* a = host[0];
+	const void* d = host[3];
+	int success = 1;
+
+	#pragma omp parallel for default(none) firstprivate(transposed, p, a, d, dtype, lanes, verbose) shared(success)
+	for (long i = 0; i < p->array_size; i++)
+	{
+		long y = i / p->dim_x;
+		long x = i % p->dim_x;
+		long in = y * (p->dim_x + p->pad_x) + x;
+		long out = transposed ? x * (p->dim_y + p->pad_x) + y : in;
+
+		for (int l = 0; l < lanes; l++)
+		{
+			double expected = dtype_get(a, dtype, in * lanes + l);
+			double obtained = dtype_get(d, dtype, out * lanes + l);
+			if (obtained != expected)
+			{
+				if (verbose) printf("Mismatch at index %ld of buffer D: Expected = %0.6f, Obtained = %0.6f\n", out, expected, obtained);
+				success = 0;
+			}
+		}
+	}
+
+	return success;
+}
+
+static const family_t family_transpose = {
+	.name        = "transpose",
+	.description = "Transpose",
+	.dims        = 2,
+	.blocked     = 0,
+	.channelized = 0,
+	.devices     = 1,
+	.typed       = 1,
+	.tile_size   = TRANSPOSE_TILE,
+	.size_args   = {3, 3},
+	.params      = PARAM(PARAM_X) | PARAM(PARAM_Y) | PARAM(PARAM_PAD_X),
+	.defaults    = {[PARAM_X] = 4096, [PARAM_Y] = 4096},
+	.kernels     = transpose_kernels,
+	.num_kernels = 3,
+	.setup_point = transpose_setup_point,
+	.set_args    = transpose_set_args,
+	.index       = transpose_index,
+	.verify      = transpose_verify
+};
+
+#endif // FAMILY_TRANSPOSE_H
@@ -0,0 +1,852 @@
+//====================================================================================================================================
+// Memory bandwidth benchmark host for OpenCL-capable FPGAs
+// Kernel type, model, vector size and block size are selected at run time, by default from the name of the kernel binary
+// Kernels run on an OpenCL device, or natively on the host CPU with "-backend cpu"
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#define _GNU_SOURCE // CPU affinity of host threads
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <unistd.h>
+
+#include "common/bench.h"
+#include "families/families.h"
+
+// Kernel configuration, either given on the command line or read from the name of the kernel binary; unknown values are -1
+typedef struct
+{
+	int type, ndr, vec, block_x, block_y, interleave, cache, reads, writes, dtype, fields, topology, depth, width, chain, tile;
+} kernel_config_t;
+
+static inline void usage(char **argv)
+{
+	printf("\nUsage: %s -type <std|chstd|blk2d|chblk2d|blk3d|chblk3d|sch|transfer|stride|gather|chase|mix|layout|transpose|chfma> -model <NDR|SWI> -vec <vector size> -bsize <block size> -bx <block size in x dimension> -by <block size in y dimension> --nointer --banks <A=<bank>,B=<bank>,...|auto[:<banks>]> --nocache -rw <R<reads>W<writes>> -dtype <float|double|half|int8|int16|int32|int64|wide> -fields <fields per record> -tsize <transpose tile size> -depth <channel depth> -width <channel width in elements> -aocx <kernel binary> -backend <opencl|cpu> -simd <scalar|avx2|avx512> --nt -threads <number of CPU threads> -numa_mem <node|interleave|local> -numa_cpu <node|all|local> -alloc <heap|thp|huge2m|huge1g|mlock|clhost> -id <OpenCL device ID> -s <buffer size in MiB> -x <row width> -y <column height> -z <plane size> -n <number of iterations> -pad <array padding indexes> -pad_x <row padding indexes> -pad_y <column padding indexes> -hw <halo width> -kib <transfer size or working set in KiB> -chunk <transfer chunk size in KiB> -stride <access stride in vectors> -locality <linear|random|block|jitter> -window <index locality window in KiB> -reads <buffers read per index> -writes <buffers written per index> -tile <records per AoSoA tile> -fma <FMAs per element> -kernel <kernel name> -copies <concurrent kernel copies> --shared -devices <number of devices> -peer <OpenCL device ID of the second device> -topology <oneway|duplex|ring|pingpong> -warmup <warm-up iterations> -ci <target confidence interval in %%> --iqr --format <text|json|csv> --verbose --verify --profile\n", argv[0]);
+}
+
+// Reads the kernel configuration from the name that make gives to kernel binaries, following symbolic links:
+// "fpga-mem-bench-kernel-<type>_<NDR|SWI>_VEC<vec>[_BX<block_x>][_BY<block_y>][...][_nointer][_nocache][_R<reads>W<writes>][_<dtype>][_F<fields>][_TILE<tile>][...][_depth<depth>][_width<width>][_FMA<chain>].aocx"
+// Values that cannot be found in the name are left unchanged
+static inline void parse_kernel_name(const char* aocx, kernel_config_t* meta)
+{
+	char path[PATH_MAX];
+	int value, writes;
+
+	if (realpath(aocx, path) == NULL)
+	{
+		return;
+	}
+	char* name = strrchr(path, '/');
+	name = (name == NULL) ? path : name + 1;
+	if (strncmp(name, KERNEL_NAME "-", strlen(KERNEL_NAME) + 1) != 0)
+	{
+		return;
+	}
+	char* ext = strrchr(name, '.');
+	if (ext != NULL)
+	{
+		*ext = '\0';
+	}
+
+	char* save = NULL;
+	char* token = strtok_r(name + strlen(KERNEL_NAME) + 1, "_", &save);
+	meta->type = (token == NULL) ? -1 : find_family(token);
+	if (meta->type < 0)
+	{
+		return;
+	}
+	meta->interleave = 1;
+	meta->cache = 1;
+
+	for (token = strtok_r(NULL, "_", &save); token != NULL; token = strtok_r(NULL, "_", &save))
+	{
+		if (strcmp(token, "NDR") == 0)
+		{
+			meta->ndr = 1;
+		}
+		else if (strcmp(token, "SWI") == 0)
+		{
+			meta->ndr = 0;
+		}
+		else if (strcmp(token, "nointer") == 0)
+		{
+			meta->interleave = 0;
+		}
+		else if (strcmp(token, "nocache") == 0)
+		{
+			meta->cache = 0;
+		}
+		else if (sscanf(token, "VEC%d", &value) == 1)
+		{
+			meta->vec = value;
+		}
+		else if (sscanf(token, "BX%d", &value) == 1)
+		{
+			meta->block_x = value;
+		}
+		else if (sscanf(token, "BY%d", &value) == 1)
+		{
+			meta->block_y = value;
+		}
+		else if (sscanf(token, "R%dW%d", &value, &writes) == 2)
+		{
+			meta->reads = value;
+			meta->writes = writes;
+		}
+		else if (sscanf(token, "F%d", &value) == 1)
+		{
+			meta->fields = value;
+		}
+		else if (sscanf(token, "TILE%d", &value) == 1)
+		{
+			meta->tile = value;
+		}
+		else if (sscanf(token, "FMA%d", &value) == 1)
+		{
+			meta->chain = value;
+		}
+		else if (sscanf(token, "depth%d", &value) == 1)
+		{
+			meta->depth = value;
+		}
+		else if (sscanf(token, "width%d", &value) == 1)
+		{
+			meta->width = value;
+		}
+		else if (parse_dtype(token) >= 0)
+		{
+			meta->dtype = parse_dtype(token);
+		}
+		else
+		{
+			for (int i = 1; i < NUM_TOPOLOGIES; i++)
+			{
+				if (strcmp(token, topology_flags[i]) == 0)
+				{
+					meta->topology = i;
+				}
+			}
+		}
+	}
+
+	// binaries of the serial channel without a topology flag are one-way
+	if (meta->topology < 0 && families[meta->type]->topology != NULL)
+	{
+		meta->topology = TOPOLOGY_ONEWAY;
+	}
+}
+
+// Returns the value given on the command line, or the one from the kernel binary name, or the default; both must match if given
+static inline int merge_option(const char* option, int given, int meta, int value, const char* aocx)
+{
+	if (given >= 0 && meta >= 0 && given != meta)
+	{
+		printf("Value of %s does not match the kernel binary \"%s\"!\n", option, aocx);
+		exit(-1);
+	}
+	return (given >= 0) ? given : (meta >= 0) ? meta : value;
+}
+
+int main(int argc, char **argv)
+{
+	// input arguments
+	bench_options_t options = {1, 0, 0, 0, 0, 0, 0, FORMAT_TEXT, 0};
+	cl_uint deviceID = 0;							// default to first device
+	int backend = BACKEND_OPENCL;
+	int simd = -1;									// default to the widest SIMD code path supported by the CPU
+	int nt = 0;
+	int threads = 0;								// default to the OpenMP default
+	numa_config_t numa = {NUMA_LOCAL, NUMA_LOCAL};	// default to first-touch placement without pinning
+	int alloc = ALLOC_HEAP;
+	int locality = -1;								// default to random indexes
+	const char* aocx = NULL;						// kernel binary, default is the link created by make
+	const char* kernel_name = NULL;					// default to all kernels of the type
+	int copies = 1;
+	int shared = 0;
+	int devices = 0;								// default to the minimum of the kernel type, one device for most
+	int peer = -1;									// default to the device after the selected one
+	int banks[MAX_BUFFERS] = {0};					// default to alternating banks 1 and 2 without interleaving
+	int auto_banks = 0;								// number of banks to run every placement in, disabled if zero
+	const char* banks_arg = NULL;
+	kernel_config_t given = {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+	kernel_config_t meta  = {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+
+	// swept parameters are parsed once the kernel type is known; every combination of values is run
+	const char* param_args[NUM_PARAMS] = {NULL};
+	sweep_t sweeps[NUM_PARAMS];
+
+	int arg = 1;
+	while (arg < argc)
+	{
+		int param = -1;
+		for (int i = 0; i < NUM_PARAMS; i++)
+		{
+			if (strcmp(argv[arg], param_options[i]) == 0)
+			{
+				param = i;
+			}
+		}
+
+		if (param >= 0)
+		{
+			param_args[param] = argv[arg + 1];
+			arg += 2;
+		}
+		else if(strcmp(argv[arg], "-id") == 0)
+		{
+			deviceID = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-type") == 0)
+		{
+			given.type = find_family(argv[arg + 1]);
+			if (given.type < 0)
+			{
+				printf("Unknown kernel type: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-model") == 0)
+		{
+			if (strcmp(argv[arg + 1], "NDR") == 0 || strcmp(argv[arg + 1], "ndr") == 0)
+			{
+				given.ndr = 1;
+			}
+			else if (strcmp(argv[arg + 1], "SWI") == 0 || strcmp(argv[arg + 1], "swi") == 0)
+			{
+				given.ndr = 0;
+			}
+			else
+			{
+				printf("Unknown kernel model: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-vec") == 0)
+		{
+			given.vec = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-bsize") == 0)
+		{
+			given.block_x = given.block_y = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-bx") == 0)
+		{
+			given.block_x = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-by") == 0)
+		{
+			given.block_y = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "--nointer") == 0)
+		{
+			given.interleave = 0;
+			arg += 1;
+		}
+		else if (strcmp(argv[arg], "--banks") == 0)
+		{
+			banks_arg = argv[arg + 1];
+			auto_banks = parse_banks(banks_arg, banks);
+			if (auto_banks < 0)
+			{
+				printf("Invalid bank placement: %s\n", banks_arg);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "--nocache") == 0)
+		{
+			given.cache = 0;
+			arg += 1;
+		}
+		else if (strcmp(argv[arg], "-rw") == 0)
+		{
+			if (sscanf(argv[arg + 1], "R%dW%d", &given.reads, &given.writes) != 2 || given.reads < 0 || given.writes < 0)
+			{
+				printf("Unknown kernel: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-dtype") == 0)
+		{
+			given.dtype = parse_dtype(argv[arg + 1]);
+			if (given.dtype < 0)
+			{
+				printf("Unknown element type: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-fields") == 0)
+		{
+			given.fields = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-tsize") == 0)
+		{
+			given.tile = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-depth") == 0)
+		{
+			given.depth = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-width") == 0)
+		{
+			given.width = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-kernel") == 0)
+		{
+			kernel_name = argv[arg + 1];
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-copies") == 0)
+		{
+			copies = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "--shared") == 0)
+		{
+			shared = 1;
+			arg += 1;
+		}
+		else if (strcmp(argv[arg], "-devices") == 0)
+		{
+			devices = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-peer") == 0)
+		{
+			peer = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-topology") == 0)
+		{
+			given.topology = parse_topology(argv[arg + 1]);
+			if (given.topology < 0)
+			{
+				printf("Unknown topology: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-aocx") == 0)
+		{
+			aocx = argv[arg + 1];
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-backend") == 0)
+		{
+			backend = (strcmp(argv[arg + 1], "cpu") == 0) ? BACKEND_CPU : (strcmp(argv[arg + 1], "opencl") == 0) ? BACKEND_OPENCL : -1;
+			if (backend < 0)
+			{
+				printf("Unknown backend: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-simd") == 0)
+		{
+			simd = parse_simd(argv[arg + 1]);
+			if (simd < 0)
+			{
+				printf("Unknown SIMD code path: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "--nt") == 0)
+		{
+			nt = 1;
+			arg += 1;
+		}
+		else if (strcmp(argv[arg], "-threads") == 0)
+		{
+			threads = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-numa_mem") == 0)
+		{
+			numa.mem = numa_parse("-numa_mem", argv[arg + 1], "interleave", NUMA_INTERLEAVE);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-numa_cpu") == 0)
+		{
+			numa.cpu = numa_parse("-numa_cpu", argv[arg + 1], "all", NUMA_ALL);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-alloc") == 0)
+		{
+			alloc = parse_alloc(argv[arg + 1]);
+			if (alloc < 0)
+			{
+				printf("Unknown allocation mode: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-locality") == 0)
+		{
+			locality = parse_locality(argv[arg + 1]);
+			if (locality < 0)
+			{
+				printf("Unknown index locality: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-n") == 0)
+		{
+			options.iter = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "--verbose") == 0)
+		{
+			options.verbose = 1;
+			arg += 1;
+		}
+		else if (strcmp(argv[arg], "--verify") == 0)
+		{
+			options.verify = 1;
+			arg += 1;
+		}
+		else if (strcmp(argv[arg], "--profile") == 0)
+		{
+			options.profile = 1;
+			arg += 1;
+		}
+		else if (strcmp(argv[arg], "-warmup") == 0)
+		{
+			options.warmup = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-ci") == 0)
+		{
+			options.ci = atof(argv[arg + 1]);
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "--iqr") == 0)
+		{
+			options.iqr = 1;
+			arg += 1;
+		}
+		else if (strcmp(argv[arg], "--format") == 0)
+		{
+			options.format = parse_format(argv[arg + 1]);
+			if (options.format < 0)
+			{
+				printf("Unknown output format: %s\n", argv[arg + 1]);
+				exit(-1);
+			}
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-h") == 0 || strcmp(argv[arg], "--help") == 0)
+		{
+			usage(argv);
+			return 0;
+		}
+		else
+		{
+			printf("\nInvalid input!");
+			usage(argv);
+			return -1;
+		}
+	}
+
+	// kernel configuration: command-line options take precedence over the name of the kernel binary, which is only used on FPGAs
+#ifdef INTEL_FPGA
+	// transfers need no kernel binary
+	int binary = (backend != BACKEND_CPU && (given.type < 0 || !families[given.type]->transfer));
+	if (!binary)
+	{
+		aocx = "";
+	}
+	else if (aocx == NULL)
+	{
+		// full-duplex and ring binaries run on every device and are linked like those of single-device types
+		int sch = find_family("sch");
+		int linked = (given.topology == TOPOLOGY_DUPLEX || given.topology == TOPOLOGY_RING);
+		aocx = (!linked && (given.type == sch || (given.type < 0 && access(KERNEL_NAME ".aocx", R_OK) != 0 && access(KERNEL_NAME "_FPGA_1.aocx", R_OK) == 0))) ? KERNEL_NAME "_FPGA_1.aocx" : KERNEL_NAME ".aocx";
+	}
+	if (binary)
+	{
+		parse_kernel_name(aocx, &meta);
+		options.fmax = get_fmax(aocx);
+	}
+#endif
+	bench_config_t config;
+	int type          = merge_option("-type" , given.type      , meta.type      , 0   , aocx);
+	config.ndr        = merge_option("-model", given.ndr       , meta.ndr       , 0   , aocx);
+	config.vec        = merge_option("-vec"  , given.vec       , meta.vec       , 1   , aocx);
+	config.block_x    = merge_option("-bx"   , given.block_x   , meta.block_x   , 1024, aocx);
+	config.block_y    = merge_option("-by"   , given.block_y   , meta.block_y   , 1024, aocx);
+	config.interleave = merge_option("--nointer", given.interleave, meta.interleave, 1, aocx);
+	config.cache      = merge_option("--nocache", given.cache, meta.cache, 1, aocx);
+	config.reads      = merge_option("-rw"   , given.reads     , meta.reads     , -1  , aocx);
+	config.writes     = merge_option("-rw"   , given.writes    , meta.writes    , -1  , aocx);
+	config.dtype      = merge_option("-dtype", given.dtype     , meta.dtype     , DTYPE_FLOAT, aocx);
+	config.fields     = merge_option("-fields", given.fields   , meta.fields    , -1  , aocx);
+	config.tile_size  = merge_option("-tsize", given.tile      , meta.tile      , -1  , aocx);
+	int topology      = merge_option("-topology", given.topology, meta.topology, -1 , aocx);
+	config.chan_depth = merge_option("-depth", given.depth     , meta.depth     , -1  , aocx);
+	config.chan_width = merge_option("-width", given.width     , meta.width     , -1  , aocx);
+	config.backend    = backend;
+	config.simd       = (simd >= 0) ? simd : cpu_simd_best();
+	config.nt         = nt;
+	config.numa       = numa;
+	config.alloc      = alloc;
+	config.locality   = (locality >= 0) ? locality : LOCALITY_RANDOM;
+	config.copies     = copies;
+	config.shared     = shared;
+	config.peer       = (peer >= 0) ? (cl_uint)peer : deviceID + 1;
+	memcpy(config.banks, banks, sizeof(banks));
+	const family_t* family = families[type];
+
+	// every topology of the serial channel is a family of its own
+	if (topology >= 0)
+	{
+		if (family->topology == NULL)
+		{
+			printf("Option -topology is only supported by kernel type \"sch\"!\n");
+			exit(-1);
+		}
+		family = sch_topologies[topology];
+	}
+
+	if (family->single && config.ndr)
+	{
+		printf("Kernel type \"%s\" only has single work-item kernels!\n", family->name);
+		exit(-1);
+	}
+
+	// kernel files built with READS and WRITES only have the generated RnWm kernel, which replaces the standard kernels
+	family_t rw_family;
+	rw_kernel_t rw_kernel;
+	if (config.reads >= 0)
+	{
+		if (!family->rw || backend == BACKEND_CPU)
+		{
+			printf("Option -rw is not supported by kernel type \"%s\" on the %s backend!\n", family->name, backend_names[backend]);
+			exit(-1);
+		}
+		if (config.reads > RW_MAX || config.writes < 1 || config.writes > RW_MAX)
+		{
+			printf("Generated kernels must have between 0 and %d inputs and between 1 and %d outputs!\n", RW_MAX, RW_MAX);
+			exit(-1);
+		}
+		init_rw_kernel(&rw_kernel, config.reads, config.writes);
+		rw_family = *family;
+		rw_family.kernels = &rw_kernel.desc;
+		rw_family.num_kernels = 1;
+		family = &rw_family;
+	}
+
+	// a single kernel can be selected, e.g. to run concurrent copies of it alone; it stays in the kernel table of the family, since
+	// some families find their own data by its position there
+	family_t selected_family;
+	if (kernel_name != NULL)
+	{
+		int k = 0;
+		while (k < family->num_kernels && strcmp(family->kernels[k].name, kernel_name) != 0)
+		{
+			k++;
+		}
+		if (k == family->num_kernels)
+		{
+			printf("Kernel \"%s\" is not part of kernel type \"%s\"!\n", kernel_name, family->name);
+			exit(-1);
+		}
+		selected_family = *family;
+		selected_family.kernels = &family->kernels[k];
+		selected_family.num_kernels = 1;
+		family = &selected_family;
+	}
+
+	// concurrent copies run in queues of their own on one device, or one copy per device on consecutive devices; channels can only be
+	// replicated with their devices, and multi-device and transfer runs not at all
+	config.devices = (devices > 0) ? devices : (family->spread > 0) ? family->spread : 1;
+	if (config.devices < 1 || config.devices > MAX_COPIES)
+	{
+		printf("Number of devices must be between 1 and %d!\n", MAX_COPIES);
+		exit(-1);
+	}
+	if (config.devices < family->spread)
+	{
+		printf("Topology \"%s\" needs at least %d devices!\n", family->topology, family->spread);
+		exit(-1);
+	}
+	if (topology == TOPOLOGY_DUPLEX && config.devices % 2 != 0)
+	{
+		printf("Topology \"duplex\" needs pairs of devices!\n");
+		exit(-1);
+	}
+	if (config.devices > 1)
+	{
+		if (config.copies > 1)
+		{
+			printf("Options -copies and -devices cannot be combined!\n");
+			exit(-1);
+		}
+		if (backend == BACKEND_CPU || family->devices > 1 || family->run != NULL || family->latency)
+		{
+			printf("Option -devices is not supported by kernel type \"%s\" on the %s backend!\n", family->name, backend_names[backend]);
+			exit(-1);
+		}
+		config.copies = config.devices;
+	}
+	if (config.copies < 1 || config.copies > MAX_COPIES)
+	{
+		printf("Number of concurrent copies must be between 1 and %d!\n", MAX_COPIES);
+		exit(-1);
+	}
+	if (config.devices == 1 && config.copies > 1 && (backend == BACKEND_CPU || family->channelized || family->devices > 1 || family->run != NULL || family->latency))
+	{
+		printf("Option -copies is not supported by kernel type \"%s\" on the %s backend!\n", family->name, backend_names[backend]);
+		exit(-1);
+	}
+	if (config.shared && (config.copies < 2 || config.devices > 1))
+	{
+		printf("Option --shared needs more than one concurrent copy on the same device!\n");
+		exit(-1);
+	}
+
+	// the second binary of multi-device families runs on any other device, e.g. the other end of a serial channel
+	if (peer >= 0 && family->devices == 1)
+	{
+		printf("Option -peer is only supported by multi-device kernel types!\n");
+		exit(-1);
+	}
+	if (family->devices > 1 && config.peer == deviceID)
+	{
+		printf("Peer device must be different from the selected device!\n");
+		exit(-1);
+	}
+
+	// the CPU backend and the kernels of the other families only handle float buffers
+	if (config.dtype != DTYPE_FLOAT && (!family->typed || backend == BACKEND_CPU))
+	{
+		printf("Element type \"%s\" is not supported by kernel type \"%s\" on the %s backend!\n", dtype_names[config.dtype], family->name, backend_names[backend]);
+		exit(-1);
+	}
+
+	// the number of fields is fixed at compile time, so that the loads of a record are coalesced in the AoS layout
+	if (config.fields >= 0 && !family->fields)
+	{
+		printf("Option -fields is not supported by kernel type \"%s\"!\n", family->name);
+		exit(-1);
+	}
+	if (family->fields)
+	{
+		config.fields = (config.fields >= 0) ? config.fields : family->fields;
+		if (config.fields < 1 || config.fields > MAX_FIELDS)
+		{
+			printf("Records must have between 1 and %d fields!\n", MAX_FIELDS);
+			exit(-1);
+		}
+	}
+
+	// the tile is fixed at compile time, since it sizes the local-memory array and the work-groups of the NDRange kernels
+	if (config.tile_size >= 0 && !family->tile_size)
+	{
+		printf("Option -tsize is not supported by kernel type \"%s\"!\n", family->name);
+		exit(-1);
+	}
+	if (family->tile_size)
+	{
+		config.tile_size = (config.tile_size >= 0) ? config.tile_size : family->tile_size;
+		if (config.tile_size < config.vec || config.tile_size % config.vec != 0)
+		{
+			printf("Tile size must be a multiple of the vector size!\n");
+			exit(-1);
+		}
+	}
+
+	// channels are 16 words deep unless built with DEPTH, and carry VEC elements per word unless built with WIDTH, i.e. CHAN_VEC; the
+	// serial channel carries half a vector per port
+	if ((config.chan_depth >= 0 || config.chan_width >= 0) && !family->channelized)
+	{
+		printf("Options -depth and -width are only supported by channelized kernel types!\n");
+		exit(-1);
+	}
+	if (family->channelized)
+	{
+		config.chan_depth = (config.chan_depth >= 0) ? config.chan_depth : 16;
+		config.chan_width = (config.chan_width >= 0) ? config.chan_width : (family->topology != NULL) ? config.vec / 2 : config.vec;
+		if (config.chan_width < 1 || config.vec % config.chan_width != 0 || (family->topology != NULL && config.chan_width != config.vec / 2))
+		{
+			printf("Channel width must divide the vector size, and be half of it for kernel type \"sch\"!\n");
+			exit(-1);
+		}
+	}
+
+	// the compute kernel implements a chain of FMAS FMAs per element, 16 by default, of which -fma are applied; all of them are run
+	// in powers of two unless -fma is given
+	char fma_sweep[32];
+	config.fma_chain = -1;
+	if (family->compute)
+	{
+		config.fma_chain = (meta.chain >= 0) ? meta.chain : CHFMA_CHAIN;
+		if (param_args[PARAM_FMA] == NULL)
+		{
+			sprintf(fma_sweep, "0:%d:*2", config.fma_chain);
+			param_args[PARAM_FMA] = fma_sweep;
+		}
+	}
+
+	if (locality >= 0 && !(family->params & PARAM(PARAM_WINDOW)))
+	{
+		printf("Option -locality is not supported by kernel type \"%s\"!\n", family->name);
+		exit(-1);
+	}
+
+	// the CPU backend runs the kernels of families whose traversal it implements
+	if (backend == BACKEND_CPU)
+	{
+		if (!family->cpu)
+		{
+			printf("Kernel type \"%s\" is not supported by the CPU backend!\n", family->name);
+			exit(-1);
+		}
+		if (!cpu_simd_supported(config.simd))
+		{
+			printf("SIMD code path \"%s\" is not supported by this CPU!\n", simd_names[config.simd]);
+			exit(-1);
+		}
+		if (config.nt && config.simd == SIMD_SCALAR)
+		{
+			printf("Non-temporal stores need the AVX2 or AVX-512 code path!\n");
+			exit(-1);
+		}
+		if (options.profile)
+		{
+			printf("Device-side timing is not available on the CPU backend!\n");
+			exit(-1);
+		}
+		if (threads > 0)
+		{
+			omp_set_num_threads(threads);
+		}
+		config.interleave = 1;
+		config.cache = 1;
+	}
+	else if (simd >= 0 || nt || threads > 0)
+	{
+		printf("Options -simd, --nt and -threads are only supported by the CPU backend!\n");
+		exit(-1);
+	}
+
+	if (alloc == ALLOC_CL_HOST && (backend == BACKEND_CPU || numa.mem != NUMA_LOCAL))
+	{
+		printf("Host buffers allocated by the OpenCL runtime cannot be used with the CPU backend or NUMA placement!\n");
+		exit(-1);
+	}
+
+	// multi-device families use one kernel binary per device, named "*_FPGA_<device number>.aocx"
+	char binaries[MAX_QUEUES][PATH_MAX];
+#ifndef INTEL_FPGA
+	if (family->channelized)
+	{
+		printf("Kernel not supported on this device!\n");
+		return -1;
+	}
+	config.interleave = 1;
+#else
+	for (int i = 0; i < family->devices && binary; i++)
+	{
+		snprintf(binaries[i], sizeof(binaries[i]), "%s", aocx);
+		if (family->devices == 1)
+		{
+			continue;
+		}
+
+		char* suffix = strstr(binaries[i], "_FPGA_1");
+		if (suffix == NULL)
+		{
+			printf("Kernel binary of the \"%s\" kernel type must be named \"*_FPGA_1.aocx\"!\n", family->name);
+			exit(-1);
+		}
+		suffix[6] = '1' + i;
+	}
+#endif
+	const char* binary_names[MAX_QUEUES] = {binaries[0], binaries[1]};
+
+	bench_setup_sweeps(family, sweeps, param_args);
+
+	// buffers can only be placed in banks by the Intel FPGA runtime, and only if the kernel binary does not interleave them
+	if (banks_arg != NULL)
+	{
+#ifdef INTEL_FPGA
+		if (backend == BACKEND_CPU || config.interleave)
+		{
+			printf("Option --banks needs a kernel binary compiled with NO_INTER=1!\n");
+			exit(-1);
+		}
+#else
+		printf("Option --banks is only supported on Intel FPGAs!\n");
+		exit(-1);
+#endif
+		if (auto_banks > 0 && bench_num_points(sweeps) > 1)
+		{
+			printf("Automatic bank placement runs a single sweep point!\n");
+			exit(-1);
+		}
+	}
+
+	if (config.vec < 1 || config.block_x < 1 || config.block_y < 1 || config.block_x % config.vec != 0)
+	{
+		printf("Block size must be a multiple of the vector size!\n");
+		exit(-1);
+	}
+
+	if (sweep_max(&sweeps[PARAM_HALO]) >= config.block_x/2 || (family->blocked == 2 && sweep_max(&sweeps[PARAM_HALO]) >= config.block_y/2))
+	{
+		printf("Halo size must be smaller than half of all the block dimensions!\n");
+		exit(-1);
+	}
+
+	if (options.warmup >= options.iter)
+	{
+		printf("Number of warm-up iterations must be smaller than the number of iterations!\n");
+		exit(-1);
+	}
+
+	// OpenCL initialization
+	bench_t bench;
+	bench_init(&bench, family, &config, deviceID);
+
+	bench_kernel_t kernels[MAX_KERNELS];
+	bench_create_kernels(&bench, binary_names, kernels, options.iter);
+
+	// buffers are allocated once for the largest sweep point and reused by all points
+	bench_fit_sweeps(&bench, sweeps, param_args);
+	point_t max_point;
+	buffer_set_t buffers;
+	bench_get_point(&bench, sweeps, -1, &max_point);
+	bench_create_buffers(&bench, &buffers, &max_point, options.verbose);
+
+	report_header(options.format);
+	if (auto_banks > 0)
+	{
+		bench_sweep_banks(&bench, kernels, &buffers, sweeps, &options, auto_banks);
+	}
+	else
+	{
+		bench_sweep(&bench, kernels, &buffers, sweeps, &options);
+	}
+
+	bench_release_kernels(&bench, kernels);
+	bench_release_buffers(&bench, &buffers);
+	bench_release(&bench);
+}
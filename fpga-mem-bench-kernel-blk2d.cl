@@ -1,8 +1,22 @@
 //====================================================================================================================================
 // Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: 2D overlapped blocking
+// With READS defined, only the kernels generated from fpga-mem-bench-kernel-rw.h are compiled, with READS inputs and WRITES outputs
 // (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
 //====================================================================================================================================
 
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+#ifndef READS
+
 //=====================================================================
 // NDRange Kernels
 //=====================================================================
@@ -11,8 +25,8 @@
 //=======================
 // Read One - Write One
 //=======================
-__kernel void R1W1(__global const float* restrict a,
-                   __global       float* restrict d,
+__kernel void R1W1(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             dim_x,
@@ -39,9 +53,9 @@ __kernel void R1W1(__global const float* restrict a,
 //=======================
 // Read Two - Write One
 //=======================
-__kernel void R2W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict d,
+__kernel void R2W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             dim_x,
@@ -68,10 +82,10 @@ __kernel void R2W1(__global const float* restrict a,
 //=======================
 // Read Three - Write One
 //=======================
-__kernel void R3W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global const float* restrict c,
-                   __global       float* restrict d,
+__kernel void R3W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global const DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             dim_x,
@@ -98,10 +112,10 @@ __kernel void R3W1(__global const float* restrict a,
 //=======================
 // Read Two - Write Two
 //=======================
-__kernel void R2W2(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict c,
-                   __global       float* restrict d,
+__kernel void R2W2(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             dim_x,
@@ -126,6 +140,66 @@ __kernel void R2W2(__global const float* restrict a,
 	}
 }
 
+//=======================
+// Read Zero - Write One
+//=======================
+__kernel void R0W1(__global       DTYPE* restrict d,
+                            const int             pad,
+                            const int             pad_x,
+                            const int             dim_x,
+                            const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_global_id(1);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int gx = bx + x - halo;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			d[index] = (DTYPE)1;
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__kernel void R1W1IP(__global       DTYPE* restrict c,
+                              const int             pad,
+                              const int             pad_x,
+                              const int             dim_x,
+                              const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_global_id(1);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int gx = bx + x - halo;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			DTYPE temp = c[index];
+
+			// halo indexes are only read, since they are written by the neighboring block
+			if (x + i >= halo && x + i < BLOCK_X - halo)
+			{
+				c[index] = temp + (DTYPE)1;
+			}
+		}
+	}
+}
+
 //=====================================================================
 // Single Work-item Kernels
 //=====================================================================
@@ -135,8 +209,8 @@ __kernel void R2W2(__global const float* restrict a,
 // Read One - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1(__global const float* restrict a,
-                   __global       float* restrict d,
+__kernel void R1W1(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             dim_x,
@@ -186,9 +260,9 @@ __kernel void R1W1(__global const float* restrict a,
 // Read Two - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict d,
+__kernel void R2W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict d,
                             const int    pad,
                             const int    pad_x,
                             const int    dim_x,
@@ -238,10 +312,10 @@ __kernel void R2W1(__global const float* restrict a,
 // Read Three - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R3W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global const float* restrict c,
-                   __global       float* restrict d,
+__kernel void R3W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global const DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int    pad,
                             const int    pad_x,
                             const int    dim_x,
@@ -291,10 +365,10 @@ __kernel void R3W1(__global const float* restrict a,
 // Read Two - Write Two
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W2(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict c,
-                   __global       float* restrict d,
+__kernel void R2W2(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int    pad,
                             const int    pad_x,
                             const int    dim_x,
@@ -341,4 +415,206 @@ __kernel void R2W2(__global const float* restrict a,
 	}
 }
 
-#endif
\ No newline at end of file
+//=======================
+// Read Zero - Write One
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R0W1(__global       DTYPE* restrict d,
+                            const int             pad,
+                            const int             pad_x,
+                            const int             dim_x,
+                            const int             dim_y,
+                            const long            loop_exit,
+                            const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int bx = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		int gx = bx + x - halo;
+
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				d[index] = (DTYPE)1;
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y++;
+
+			if (y == dim_y)
+			{
+				y = 0;
+				bx += BLOCK_X - 2 * halo;
+			}
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1IP(__global       DTYPE* restrict c,
+                              const int             pad,
+                              const int             pad_x,
+                              const int             dim_x,
+                              const int             dim_y,
+                              const long            loop_exit,
+                              const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int bx = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		int gx = bx + x - halo;
+
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				DTYPE temp = c[index];
+
+				// halo indexes are only read, since they are written by the neighboring block
+				if (x + i >= halo && x + i < BLOCK_X - halo)
+				{
+					c[index] = temp + (DTYPE)1;
+				}
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y++;
+
+			if (y == dim_y)
+			{
+				y = 0;
+				bx += BLOCK_X - 2 * halo;
+			}
+		}
+	}
+}
+
+#endif
+
+#else
+
+#include "fpga-mem-bench-kernel-rw.h"
+
+//=====================================================================
+// Generated Kernels
+//=====================================================================
+#ifdef NDR
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__kernel void RW_KERNEL(RW_INPUTS
+                        RW_OUTPUTS
+                                 const int             pad,
+                                 const int             pad_x,
+                                 const int             dim_x,
+                                 const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_global_id(1);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int gx = bx + x - halo;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			DTYPE value = RW_SUM(index);
+			RW_PUT(index, value);
+		}
+	}
+}
+
+#else
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void RW_KERNEL(RW_INPUTS
+                        RW_OUTPUTS
+                                 const int    pad,
+                                 const int    pad_x,
+                                 const int    dim_x,
+                                 const int    dim_y,
+                                 const long   loop_exit,
+                                 const int    halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int bx = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		int gx = bx + x - halo;
+
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				DTYPE value = RW_SUM(index);
+				RW_PUT(index, value);
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y++;
+
+			if (y == dim_y)
+			{
+				y = 0;
+				bx += BLOCK_X - 2 * halo;
+			}
+		}
+	}
+}
+
+#endif
+
+#endif // READS
@@ -1,8 +1,22 @@
 //====================================================================================================================================
 // Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: 3D overlapped blocking
+// With READS defined, only the kernels generated from fpga-mem-bench-kernel-rw.h are compiled, with READS inputs and WRITES outputs
 // (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
 //====================================================================================================================================
 
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+#ifndef READS
+
 //=====================================================================
 // NDRange Kernels
 //=====================================================================
@@ -11,8 +25,8 @@
 //=======================
 // Read One - Write One
 //=======================
-__kernel void R1W1(__global const float* restrict a,
-                   __global       float* restrict d,
+__kernel void R1W1(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             pad_y,
@@ -45,9 +59,9 @@ __kernel void R1W1(__global const float* restrict a,
 //=======================
 // Read Two - Write One
 //=======================
-__kernel void R2W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict d,
+__kernel void R2W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             pad_y,
@@ -81,10 +95,10 @@ __kernel void R2W1(__global const float* restrict a,
 //=======================
 // Read Three - Write One
 //=======================
-__kernel void R3W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global const float* restrict c,
-                   __global       float* restrict d,
+__kernel void R3W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global const DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             pad_y,
@@ -118,10 +132,10 @@ __kernel void R3W1(__global const float* restrict a,
 //=======================
 // Read Two - Write Two
 //=======================
-__kernel void R2W2(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict c,
-                   __global       float* restrict d,
+__kernel void R2W2(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             pad_y,
@@ -153,6 +167,78 @@ __kernel void R2W2(__global const float* restrict a,
 	}
 }
 
+//=======================
+// Read Zero - Write One
+//=======================
+__kernel void R0W1(__global       DTYPE* restrict d,
+                            const int             pad,
+                            const int             pad_x,
+                            const int             pad_y,
+                            const int             dim_x,
+                            const int             dim_y,
+                            const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_local_id(1);
+	int gidy = get_group_id(1);
+	int z = get_global_id(2);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int by = gidy * (BLOCK_Y - 2 * halo);
+	int gx = bx + x - halo;
+	int gy = by + y - halo;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+		{
+			d[index] = (DTYPE)1;
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__kernel void R1W1IP(__global       DTYPE* restrict c,
+                              const int             pad,
+                              const int             pad_x,
+                              const int             pad_y,
+                              const int             dim_x,
+                              const int             dim_y,
+                              const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_local_id(1);
+	int gidy = get_group_id(1);
+	int z = get_global_id(2);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int by = gidy * (BLOCK_Y - 2 * halo);
+	int gx = bx + x - halo;
+	int gy = by + y - halo;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+		{
+			DTYPE temp = c[index];
+
+			// halo indexes are only read, since they are written by the neighboring block
+			if (x + i >= halo && x + i < BLOCK_X - halo && y >= halo && y < BLOCK_Y - halo)
+			{
+				c[index] = temp + (DTYPE)1;
+			}
+		}
+	}
+}
+
 //=====================================================================
 // Single Work-item Kernels
 //=====================================================================
@@ -162,8 +248,8 @@ __kernel void R2W2(__global const float* restrict a,
 // Read One - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1(__global const float* restrict a,
-                   __global       float* restrict d,
+__kernel void R1W1(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             pad_y,
@@ -229,9 +315,9 @@ __kernel void R1W1(__global const float* restrict a,
 // Read Two - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict d,
+__kernel void R2W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             pad_y,
@@ -297,10 +383,10 @@ __kernel void R2W1(__global const float* restrict a,
 // Read Three - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R3W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global const float* restrict c,
-                   __global       float* restrict d,
+__kernel void R3W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global const DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             pad_y,
@@ -366,10 +452,10 @@ __kernel void R3W1(__global const float* restrict a,
 // Read Two - Write Two
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W2(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict c,
-                   __global       float* restrict d,
+__kernel void R2W2(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const int             pad_x,
                             const int             pad_y,
@@ -432,4 +518,261 @@ __kernel void R2W2(__global const float* restrict a,
 	}
 }
 
-#endif
\ No newline at end of file
+//=======================
+// Read Zero - Write One
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R0W1(__global       DTYPE* restrict d,
+                            const int             pad,
+                            const int             pad_x,
+                            const int             pad_y,
+                            const int             dim_x,
+                            const int             dim_y,
+                            const int             dim_z,
+                            const int             last_x,
+                            const long            loop_exit,
+                            const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int bx = 0;
+	int by = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		int gx = bx + x - halo;
+		int gy = by + y - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+			{
+				d[index] = (DTYPE)1;
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y = (y + 1) & (BLOCK_Y - 1);
+
+			if (y == 0)
+			{
+				z++;
+
+				if (z == dim_z)
+				{
+					z = 0;
+					bx += BLOCK_X - 2 * halo;
+
+					if (bx == last_x)
+					{
+						bx = 0;
+						by += BLOCK_Y - 2 * halo;
+					}
+				}
+			}
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1IP(__global       DTYPE* restrict c,
+                              const int             pad,
+                              const int             pad_x,
+                              const int             pad_y,
+                              const int             dim_x,
+                              const int             dim_y,
+                              const int             dim_z,
+                              const int             last_x,
+                              const long            loop_exit,
+                              const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int bx = 0;
+	int by = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		int gx = bx + x - halo;
+		int gy = by + y - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+			{
+				DTYPE temp = c[index];
+
+				// halo indexes are only read, since they are written by the neighboring block
+				if (x + i >= halo && x + i < BLOCK_X - halo && y >= halo && y < BLOCK_Y - halo)
+				{
+					c[index] = temp + (DTYPE)1;
+				}
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y = (y + 1) & (BLOCK_Y - 1);
+
+			if (y == 0)
+			{
+				z++;
+
+				if (z == dim_z)
+				{
+					z = 0;
+					bx += BLOCK_X - 2 * halo;
+
+					if (bx == last_x)
+					{
+						bx = 0;
+						by += BLOCK_Y - 2 * halo;
+					}
+				}
+			}
+		}
+	}
+}
+
+#endif
+
+#else
+
+#include "fpga-mem-bench-kernel-rw.h"
+
+//=====================================================================
+// Generated Kernels
+//=====================================================================
+#ifdef NDR
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__kernel void RW_KERNEL(RW_INPUTS
+                        RW_OUTPUTS
+                                 const int             pad,
+                                 const int             pad_x,
+                                 const int             pad_y,
+                                 const int             dim_x,
+                                 const int             dim_y,
+                                 const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_local_id(1);
+	int gidy = get_group_id(1);
+	int z = get_global_id(2);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int by = gidy * (BLOCK_Y - 2 * halo);
+	int gx = bx + x - halo;
+	int gy = by + y - halo;
+
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+		{
+			DTYPE value = RW_SUM(index);
+			RW_PUT(index, value);
+		}
+	}
+}
+
+#else
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void RW_KERNEL(RW_INPUTS
+                        RW_OUTPUTS
+                                 const int             pad,
+                                 const int             pad_x,
+                                 const int             pad_y,
+                                 const int             dim_x,
+                                 const int             dim_y,
+                                 const int             dim_z,
+                                 const int             last_x,
+                                 const long            loop_exit,
+                                 const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int bx = 0;
+	int by = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		int gx = bx + x - halo;
+		int gy = by + y - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+			{
+				DTYPE value = RW_SUM(index);
+				RW_PUT(index, value);
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y = (y + 1) & (BLOCK_Y - 1);
+
+			if (y == 0)
+			{
+				z++;
+
+				if (z == dim_z)
+				{
+					z = 0;
+					bx += BLOCK_X - 2 * halo;
+
+					if (bx == last_x)
+					{
+						bx = 0;
+						by += BLOCK_Y - 2 * halo;
+					}
+				}
+			}
+		}
+	}
+}
+
+#endif
+
+#endif // READS
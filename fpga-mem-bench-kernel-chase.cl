@@ -0,0 +1,32 @@
+//====================================================================================================================================
+// Memory latency benchmark kernel for OpenCL-capable FPGAs: Pointer chasing
+// Every load returns the index of the next one, following a random cyclic permutation built by the host, so that no two loads
+// can be in flight at the same time; only implemented as a single work-item kernel
+// With NO_CACHE, the buffer is accessed through a volatile pointer, which stops the compiler from building a cache for its loads
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifdef NO_CACHE
+	#define CACHE volatile
+#else
+	#define CACHE
+#endif
+
+//=======================
+// Pointer chase
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void CHASE(__global CACHE const int* restrict b,
+                    __global       int* restrict d,
+                             const long          exit)
+{
+	int next = 0;
+
+	for (long i = 0; i < exit; i++)
+	{
+		next = b[next];
+	}
+
+	// to prevent the compiler from optimizing out the memory accesses
+	d[0] = next;
+}
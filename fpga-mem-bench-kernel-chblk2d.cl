@@ -1,8 +1,20 @@
 //====================================================================================================================================
 // Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Channelized 2D overlapped blocking
+// With READS defined, only the kernels generated from fpga-mem-bench-kernel-rw.h are compiled, with READS inputs and WRITES outputs
 // (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
 //====================================================================================================================================
 
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
 #ifdef LEGACY
 	#pragma OPENCL EXTENSION cl_altera_channels : enable
 	#define read_channel read_channel_altera
@@ -17,19 +29,62 @@
 	#define DEPTH 16
 #endif
 
+// channels carry words of CHAN_VEC elements, VEC by default; narrower channels take VEC / CHAN_VEC words per vector
+#ifndef CHAN_VEC
+	#define CHAN_VEC VEC
+#endif
+#if VEC % CHAN_VEC != 0
+	#error "VEC must be a multiple of CHAN_VEC"
+#endif
+
 typedef struct
 {
-	float data[VEC];
+	DTYPE data[VEC];
 } CHAN_WIDTH;
 
-channel CHAN_WIDTH ch_R1W1   __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W1_a __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W1_b __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R3W1_a __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R3W1_b __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R3W1_c __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W2_a __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W2_b __attribute__((depth(DEPTH)));
+typedef struct
+{
+	DTYPE data[CHAN_VEC];
+} CHAN_WORD;
+
+// send or receive a vector as consecutive channel words
+#define write_vector(ch, vector)                                                   \
+	_Pragma("unroll")                                                              \
+	for (int chan_w = 0; chan_w < VEC / CHAN_VEC; chan_w++)                        \
+	{                                                                              \
+		CHAN_WORD chan_word;                                                       \
+		_Pragma("unroll")                                                          \
+		for (int chan_i = 0; chan_i < CHAN_VEC; chan_i++)                          \
+		{                                                                          \
+			chan_word.data[chan_i] = (vector).data[chan_w * CHAN_VEC + chan_i];    \
+		}                                                                          \
+		write_channel(ch, chan_word);                                              \
+	}
+
+#define read_vector(ch, vector)                                                    \
+	_Pragma("unroll")                                                              \
+	for (int chan_w = 0; chan_w < VEC / CHAN_VEC; chan_w++)                        \
+	{                                                                              \
+		CHAN_WORD chan_word = read_channel(ch);                                    \
+		_Pragma("unroll")                                                          \
+		for (int chan_i = 0; chan_i < CHAN_VEC; chan_i++)                          \
+		{                                                                          \
+			(vector).data[chan_w * CHAN_VEC + chan_i] = chan_word.data[chan_i];    \
+		}                                                                          \
+	}
+
+#ifndef READS
+
+channel CHAN_WORD ch_R1W1   __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W1_a __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W1_b __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R3W1_a __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R3W1_b __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R3W1_c __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W2_a __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W2_b __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R0W1   __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R1W1IP __attribute__((depth(DEPTH)));
 
 //=====================================================================
 // NDRange Kernels
@@ -39,7 +94,7 @@ channel CHAN_WIDTH ch_R2W2_b __attribute__((depth(DEPTH)));
 //=======================
 // Read One - Write One
 //=======================
-__kernel void R1W1_read(__global const float* restrict a,
+__kernel void R1W1_read(__global const DTYPE* restrict a,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             dim_x,
@@ -63,10 +118,10 @@ __kernel void R1W1_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R1W1, temp);
+	write_vector(ch_R1W1, temp);
 }
 
-__kernel void R1W1_write(__global       float* restrict d,
+__kernel void R1W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             dim_x,
@@ -79,7 +134,7 @@ __kernel void R1W1_write(__global       float* restrict d,
 	int gx = bx + x - halo;
 	CHAN_WIDTH temp;
 
-	temp = read_channel(ch_R1W1);
+	read_vector(ch_R1W1, temp);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -96,8 +151,8 @@ __kernel void R1W1_write(__global       float* restrict d,
 //=======================
 // Read Two - Write One
 //=======================
-__kernel void R2W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             dim_x,
@@ -122,11 +177,11 @@ __kernel void R2W1_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R2W1_a, temp_a);
-	write_channel(ch_R2W1_b, temp_b);
+	write_vector(ch_R2W1_a, temp_a);
+	write_vector(ch_R2W1_b, temp_b);
 }
 
-__kernel void R2W1_write(__global       float* restrict d,
+__kernel void R2W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             dim_x,
@@ -139,8 +194,8 @@ __kernel void R2W1_write(__global       float* restrict d,
 	int gx = bx + x - halo;
 	CHAN_WIDTH temp_a, temp_b;
 
-	temp_a = read_channel(ch_R2W1_a);
-	temp_b = read_channel(ch_R2W1_b);
+	read_vector(ch_R2W1_a, temp_a);
+	read_vector(ch_R2W1_b, temp_b);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -157,9 +212,9 @@ __kernel void R2W1_write(__global       float* restrict d,
 //=======================
 // Read Three - Write One
 //=======================
-__kernel void R3W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
-                        __global const float* restrict c,
+__kernel void R3W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
+                        __global const DTYPE* restrict c,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             dim_x,
@@ -185,12 +240,12 @@ __kernel void R3W1_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R3W1_a, temp_a);
-	write_channel(ch_R3W1_b, temp_b);
-	write_channel(ch_R3W1_c, temp_c);
+	write_vector(ch_R3W1_a, temp_a);
+	write_vector(ch_R3W1_b, temp_b);
+	write_vector(ch_R3W1_c, temp_c);
 }
 
-__kernel void R3W1_write(__global       float* restrict d,
+__kernel void R3W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             dim_x,
@@ -203,9 +258,9 @@ __kernel void R3W1_write(__global       float* restrict d,
 	int gx = bx + x - halo;
 	CHAN_WIDTH temp_a, temp_b, temp_c;
 
-	temp_a = read_channel(ch_R3W1_a);
-	temp_b = read_channel(ch_R3W1_b);
-	temp_c = read_channel(ch_R3W1_c);
+	read_vector(ch_R3W1_a, temp_a);
+	read_vector(ch_R3W1_b, temp_b);
+	read_vector(ch_R3W1_c, temp_c);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -222,8 +277,8 @@ __kernel void R3W1_write(__global       float* restrict d,
 //=======================
 // Read Two - Write Two
 //=======================
-__kernel void R2W2_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W2_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             dim_x,
@@ -248,12 +303,12 @@ __kernel void R2W2_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R2W2_a, temp_a);
-	write_channel(ch_R2W2_b, temp_b);
+	write_vector(ch_R2W2_a, temp_a);
+	write_vector(ch_R2W2_b, temp_b);
 }
 
-__kernel void R2W2_write(__global       float* restrict c,
-                         __global       float* restrict d,
+__kernel void R2W2_write(__global       DTYPE* restrict c,
+                         __global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             dim_x,
@@ -266,8 +321,8 @@ __kernel void R2W2_write(__global       float* restrict c,
 	int gx = bx + x - halo;
 	CHAN_WIDTH temp_a, temp_b;
 
-	temp_a = read_channel(ch_R2W2_a);
-	temp_b = read_channel(ch_R2W2_b);
+	read_vector(ch_R2W2_a, temp_a);
+	read_vector(ch_R2W2_b, temp_b);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -282,6 +337,122 @@ __kernel void R2W2_write(__global       float* restrict c,
 	}
 }
 
+//=======================
+// Read Zero - Write One
+//=======================
+__kernel void R0W1_read(const int             pad,
+                        const int             pad_x,
+                        const int             dim_x,
+                        const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_global_id(1);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int gx = bx + x - halo;
+	CHAN_WIDTH temp;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			temp.data[i] = (DTYPE)1;
+		}
+	}
+
+	write_vector(ch_R0W1, temp);
+}
+
+__kernel void R0W1_write(__global       DTYPE* restrict d,
+                                  const int             pad,
+                                  const int             pad_x,
+                                  const int             dim_x,
+                                  const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_global_id(1);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int gx = bx + x - halo;
+	CHAN_WIDTH temp;
+
+	read_vector(ch_R0W1, temp);
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			d[index] = temp.data[i];
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__kernel void R1W1IP_read(__global const DTYPE* restrict c,
+                                   const int             pad,
+                                   const int             pad_x,
+                                   const int             dim_x,
+                                   const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_global_id(1);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int gx = bx + x - halo;
+	CHAN_WIDTH temp;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			temp.data[i] = c[index];
+		}
+	}
+
+	write_vector(ch_R1W1IP, temp);
+}
+
+__kernel void R1W1IP_write(__global       DTYPE* restrict c,
+                                    const int             pad,
+                                    const int             pad_x,
+                                    const int             dim_x,
+                                    const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_global_id(1);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int gx = bx + x - halo;
+	CHAN_WIDTH temp;
+
+	read_vector(ch_R1W1IP, temp);
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			// halo indexes are only read, since they are written by the neighboring block
+			if (x + i >= halo && x + i < BLOCK_X - halo)
+			{
+				c[index] = temp.data[i] + (DTYPE)1;
+			}
+		}
+	}
+}
+
 //=====================================================================
 // Single Work-item Kernels
 //=====================================================================
@@ -291,7 +462,7 @@ __kernel void R2W2_write(__global       float* restrict c,
 // Read One - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1_read(__global const float* restrict a,
+__kernel void R1W1_read(__global const DTYPE* restrict a,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             dim_x,
@@ -323,7 +494,7 @@ __kernel void R1W1_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R1W1, temp);
+		write_vector(ch_R1W1, temp);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -341,7 +512,7 @@ __kernel void R1W1_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1_write(__global       float* restrict d,
+__kernel void R1W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             dim_x,
@@ -359,7 +530,7 @@ __kernel void R1W1_write(__global       float* restrict d,
 		cond++;
 
 		CHAN_WIDTH temp;
-		temp = read_channel(ch_R1W1);
+		read_vector(ch_R1W1, temp);
 
 		int gx = bx + x - halo;
 		#pragma unroll
@@ -393,8 +564,8 @@ __kernel void R1W1_write(__global       float* restrict d,
 // Read Two - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             dim_x,
@@ -427,8 +598,8 @@ __kernel void R2W1_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R2W1_a, temp_a);
-		write_channel(ch_R2W1_b, temp_b);
+		write_vector(ch_R2W1_a, temp_a);
+		write_vector(ch_R2W1_b, temp_b);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -446,7 +617,7 @@ __kernel void R2W1_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W1_write(__global       float* restrict d,
+__kernel void R2W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             dim_x,
@@ -464,8 +635,8 @@ __kernel void R2W1_write(__global       float* restrict d,
 		cond++;
 
 		CHAN_WIDTH temp_a, temp_b;
-		temp_a = read_channel(ch_R2W1_a);
-		temp_b = read_channel(ch_R2W1_b);
+		read_vector(ch_R2W1_a, temp_a);
+		read_vector(ch_R2W1_b, temp_b);
 
 		int gx = bx + x - halo;
 		#pragma unroll
@@ -499,9 +670,9 @@ __kernel void R2W1_write(__global       float* restrict d,
 // Read Three - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R3W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
-                        __global const float* restrict c,
+__kernel void R3W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
+                        __global const DTYPE* restrict c,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             dim_x,
@@ -535,9 +706,9 @@ __kernel void R3W1_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R3W1_a, temp_a);
-		write_channel(ch_R3W1_b, temp_b);
-		write_channel(ch_R3W1_c, temp_c);
+		write_vector(ch_R3W1_a, temp_a);
+		write_vector(ch_R3W1_b, temp_b);
+		write_vector(ch_R3W1_c, temp_c);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -555,7 +726,7 @@ __kernel void R3W1_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R3W1_write(__global       float* restrict d,
+__kernel void R3W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             dim_x,
@@ -573,9 +744,9 @@ __kernel void R3W1_write(__global       float* restrict d,
 		cond++;
 
 		CHAN_WIDTH temp_a, temp_b, temp_c;
-		temp_a = read_channel(ch_R3W1_a);
-		temp_b = read_channel(ch_R3W1_b);
-		temp_c = read_channel(ch_R3W1_c);
+		read_vector(ch_R3W1_a, temp_a);
+		read_vector(ch_R3W1_b, temp_b);
+		read_vector(ch_R3W1_c, temp_c);
 
 		int gx = bx + x - halo;
 		#pragma unroll
@@ -609,8 +780,8 @@ __kernel void R3W1_write(__global       float* restrict d,
 // Read Two - Write Two
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W2_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W2_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             dim_x,
@@ -643,8 +814,8 @@ __kernel void R2W2_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R2W2_a, temp_a);
-		write_channel(ch_R2W2_b, temp_b);
+		write_vector(ch_R2W2_a, temp_a);
+		write_vector(ch_R2W2_b, temp_b);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -662,8 +833,8 @@ __kernel void R2W2_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W2_write(__global       float* restrict c,
-                         __global       float* restrict d,
+__kernel void R2W2_write(__global       DTYPE* restrict c,
+                         __global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             dim_x,
@@ -681,8 +852,8 @@ __kernel void R2W2_write(__global       float* restrict c,
 		cond++;
 
 		CHAN_WIDTH temp_a, temp_b;
-		temp_a = read_channel(ch_R2W2_a);
-		temp_b = read_channel(ch_R2W2_b);
+		read_vector(ch_R2W2_a, temp_a);
+		read_vector(ch_R2W2_b, temp_b);
 
 		int gx = bx + x - halo;
 		#pragma unroll
@@ -713,4 +884,413 @@ __kernel void R2W2_write(__global       float* restrict c,
 	}
 }
 
-#endif
\ No newline at end of file
+//=======================
+// Read Zero - Write One
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R0W1_read(const int             pad,
+                        const int             pad_x,
+                        const int             dim_x,
+                        const int             dim_y,
+                        const long            loop_exit,
+                        const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int bx = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+
+		int gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				temp.data[i] = (DTYPE)1;
+			}
+		}
+
+		write_vector(ch_R0W1, temp);
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y++;
+
+			if (y == dim_y)
+			{
+				y = 0;
+				bx += BLOCK_X - 2 * halo;
+			}
+		}
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void R0W1_write(__global       DTYPE* restrict d,
+                                  const int             pad,
+                                  const int             pad_x,
+                                  const int             dim_x,
+                                  const int             dim_y,
+                                  const long            loop_exit,
+                                  const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int bx = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+		read_vector(ch_R0W1, temp);
+
+		int gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				d[index] = temp.data[i];
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y++;
+
+			if (y == dim_y)
+			{
+				y = 0;
+				bx += BLOCK_X - 2 * halo;
+			}
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1IP_read(__global const DTYPE* restrict c,
+                                   const int             pad,
+                                   const int             pad_x,
+                                   const int             dim_x,
+                                   const int             dim_y,
+                                   const long            loop_exit,
+                                   const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int bx = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+
+		int gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				temp.data[i] = c[index];
+			}
+		}
+
+		write_vector(ch_R1W1IP, temp);
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y++;
+
+			if (y == dim_y)
+			{
+				y = 0;
+				bx += BLOCK_X - 2 * halo;
+			}
+		}
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1IP_write(__global       DTYPE* restrict c,
+                                    const int             pad,
+                                    const int             pad_x,
+                                    const int             dim_x,
+                                    const int             dim_y,
+                                    const long            loop_exit,
+                                    const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int bx = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+		read_vector(ch_R1W1IP, temp);
+
+		int gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				// halo indexes are only read, since they are written by the neighboring block
+				if (x + i >= halo && x + i < BLOCK_X - halo)
+				{
+					c[index] = temp.data[i] + (DTYPE)1;
+				}
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y++;
+
+			if (y == dim_y)
+			{
+				y = 0;
+				bx += BLOCK_X - 2 * halo;
+			}
+		}
+	}
+}
+
+#endif
+
+#else
+
+#include "fpga-mem-bench-kernel-rw.h"
+
+channel CHAN_WORD ch_RW[RW_CHANNELS] __attribute__((depth(DEPTH)));
+
+//=====================================================================
+// Generated Kernels
+//=====================================================================
+#ifdef NDR
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__kernel void RW_READ(RW_INPUTS
+                               const int             pad,
+                               const int             pad_x,
+                               const int             dim_x,
+                               const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_global_id(1);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int gx = bx + x - halo;
+	CHAN_WIDTH temp[RW_CHANNELS];
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			RW_GET(temp, i, index);
+		}
+	}
+
+	#pragma unroll
+	for (int j = 0; j < RW_CHANNELS; j++)
+	{
+		write_vector(ch_RW[j], temp[j]);
+	}
+}
+
+__kernel void RW_WRITE(RW_OUTPUTS
+                                const int             pad,
+                                const int             pad_x,
+                                const int             dim_x,
+                                const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_global_id(1);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int gx = bx + x - halo;
+	CHAN_WIDTH temp[RW_CHANNELS];
+
+	#pragma unroll
+	for (int j = 0; j < RW_CHANNELS; j++)
+	{
+		read_vector(ch_RW[j], temp[j]);
+	}
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			DTYPE value = temp[0].data[i];
+			#pragma unroll
+			for (int j = 1; j < RW_CHANNELS; j++)
+			{
+				value += temp[j].data[i];
+			}
+			RW_PUT(index, value);
+		}
+	}
+}
+
+#else
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void RW_READ(RW_INPUTS
+                               const int             pad,
+                               const int             pad_x,
+                               const int             dim_x,
+                               const int             dim_y,
+                               const long            loop_exit,
+                               const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int bx = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp[RW_CHANNELS];
+
+		int gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				RW_GET(temp, i, index);
+			}
+		}
+
+		#pragma unroll
+		for (int j = 0; j < RW_CHANNELS; j++)
+		{
+			write_vector(ch_RW[j], temp[j]);
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y++;
+
+			if (y == dim_y)
+			{
+				y = 0;
+				bx += BLOCK_X - 2 * halo;
+			}
+		}
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void RW_WRITE(RW_OUTPUTS
+                                const int             pad,
+                                const int             pad_x,
+                                const int             dim_x,
+                                const int             dim_y,
+                                const long            loop_exit,
+                                const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int bx = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp[RW_CHANNELS];
+		#pragma unroll
+		for (int j = 0; j < RW_CHANNELS; j++)
+		{
+			read_vector(ch_RW[j], temp[j]);
+		}
+
+		int gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + y * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				DTYPE value = temp[0].data[i];
+				#pragma unroll
+				for (int j = 1; j < RW_CHANNELS; j++)
+				{
+					value += temp[j].data[i];
+				}
+				RW_PUT(index, value);
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y++;
+
+			if (y == dim_y)
+			{
+				y = 0;
+				bx += BLOCK_X - 2 * halo;
+			}
+		}
+	}
+}
+
+#endif
+
+#endif // READS
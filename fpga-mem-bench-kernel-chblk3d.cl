@@ -1,8 +1,20 @@
 //====================================================================================================================================
 // Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Channelized 3D overlapped blocking
+// With READS defined, only the kernels generated from fpga-mem-bench-kernel-rw.h are compiled, with READS inputs and WRITES outputs
 // (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
 //====================================================================================================================================
 
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
 #ifdef LEGACY
 	#pragma OPENCL EXTENSION cl_altera_channels : enable
 	#define read_channel read_channel_altera
@@ -17,19 +29,62 @@
 	#define DEPTH 16
 #endif
 
+// channels carry words of CHAN_VEC elements, VEC by default; narrower channels take VEC / CHAN_VEC words per vector
+#ifndef CHAN_VEC
+	#define CHAN_VEC VEC
+#endif
+#if VEC % CHAN_VEC != 0
+	#error "VEC must be a multiple of CHAN_VEC"
+#endif
+
 typedef struct
 {
-	float data[VEC];
+	DTYPE data[VEC];
 } CHAN_WIDTH;
 
-channel CHAN_WIDTH ch_R1W1   __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W1_a __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W1_b __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R3W1_a __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R3W1_b __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R3W1_c __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W2_a __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W2_b __attribute__((depth(DEPTH)));
+typedef struct
+{
+	DTYPE data[CHAN_VEC];
+} CHAN_WORD;
+
+// send or receive a vector as consecutive channel words
+#define write_vector(ch, vector)                                                   \
+	_Pragma("unroll")                                                              \
+	for (int chan_w = 0; chan_w < VEC / CHAN_VEC; chan_w++)                        \
+	{                                                                              \
+		CHAN_WORD chan_word;                                                       \
+		_Pragma("unroll")                                                          \
+		for (int chan_i = 0; chan_i < CHAN_VEC; chan_i++)                          \
+		{                                                                          \
+			chan_word.data[chan_i] = (vector).data[chan_w * CHAN_VEC + chan_i];    \
+		}                                                                          \
+		write_channel(ch, chan_word);                                              \
+	}
+
+#define read_vector(ch, vector)                                                    \
+	_Pragma("unroll")                                                              \
+	for (int chan_w = 0; chan_w < VEC / CHAN_VEC; chan_w++)                        \
+	{                                                                              \
+		CHAN_WORD chan_word = read_channel(ch);                                    \
+		_Pragma("unroll")                                                          \
+		for (int chan_i = 0; chan_i < CHAN_VEC; chan_i++)                          \
+		{                                                                          \
+			(vector).data[chan_w * CHAN_VEC + chan_i] = chan_word.data[chan_i];    \
+		}                                                                          \
+	}
+
+#ifndef READS
+
+channel CHAN_WORD ch_R1W1   __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W1_a __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W1_b __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R3W1_a __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R3W1_b __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R3W1_c __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W2_a __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W2_b __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R0W1   __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R1W1IP __attribute__((depth(DEPTH)));
 
 //=====================================================================
 // NDRange Kernels
@@ -39,7 +94,7 @@ channel CHAN_WIDTH ch_R2W2_b __attribute__((depth(DEPTH)));
 //=======================
 // Read One - Write One
 //=======================
-__kernel void R1W1_read(__global const float* restrict a,
+__kernel void R1W1_read(__global const DTYPE* restrict a,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             pad_y,
@@ -69,10 +124,10 @@ __kernel void R1W1_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R1W1, temp);
+	write_vector(ch_R1W1, temp);
 }
 
-__kernel void R1W1_write(__global       float* restrict d,
+__kernel void R1W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             pad_y,
@@ -91,7 +146,7 @@ __kernel void R1W1_write(__global       float* restrict d,
 	int gy = by + y - halo;
 	CHAN_WIDTH temp;
 
-	temp = read_channel(ch_R1W1);
+	read_vector(ch_R1W1, temp);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -108,8 +163,8 @@ __kernel void R1W1_write(__global       float* restrict d,
 //=======================
 // Read Two - Write One
 //=======================
-__kernel void R2W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             pad_y,
@@ -140,11 +195,11 @@ __kernel void R2W1_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R2W1_a, temp_a);
-	write_channel(ch_R2W1_b, temp_b);
+	write_vector(ch_R2W1_a, temp_a);
+	write_vector(ch_R2W1_b, temp_b);
 }
 
-__kernel void R2W1_write(__global       float* restrict d,
+__kernel void R2W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             pad_y,
@@ -163,8 +218,8 @@ __kernel void R2W1_write(__global       float* restrict d,
 	int gy = by + y - halo;
 	CHAN_WIDTH temp_a, temp_b;
 
-	temp_a = read_channel(ch_R2W1_a);
-	temp_b = read_channel(ch_R2W1_b);
+	read_vector(ch_R2W1_a, temp_a);
+	read_vector(ch_R2W1_b, temp_b);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -181,9 +236,9 @@ __kernel void R2W1_write(__global       float* restrict d,
 //=======================
 // Read Three - Write One
 //=======================
-__kernel void R3W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
-                        __global const float* restrict c,
+__kernel void R3W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
+                        __global const DTYPE* restrict c,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             pad_y,
@@ -215,12 +270,12 @@ __kernel void R3W1_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R3W1_a, temp_a);
-	write_channel(ch_R3W1_b, temp_b);
-	write_channel(ch_R3W1_c, temp_c);
+	write_vector(ch_R3W1_a, temp_a);
+	write_vector(ch_R3W1_b, temp_b);
+	write_vector(ch_R3W1_c, temp_c);
 }
 
-__kernel void R3W1_write(__global       float* restrict d,
+__kernel void R3W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             pad_y,
@@ -239,9 +294,9 @@ __kernel void R3W1_write(__global       float* restrict d,
 	int gy = by + y - halo;
 	CHAN_WIDTH temp_a, temp_b, temp_c;
 
-	temp_a = read_channel(ch_R3W1_a);
-	temp_b = read_channel(ch_R3W1_b);
-	temp_c = read_channel(ch_R3W1_c);
+	read_vector(ch_R3W1_a, temp_a);
+	read_vector(ch_R3W1_b, temp_b);
+	read_vector(ch_R3W1_c, temp_c);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -258,8 +313,8 @@ __kernel void R3W1_write(__global       float* restrict d,
 //=======================
 // Read Two - Write Two
 //=======================
-__kernel void R2W2_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W2_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             pad_y,
@@ -290,12 +345,12 @@ __kernel void R2W2_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R2W2_a, temp_a);
-	write_channel(ch_R2W2_b, temp_b);
+	write_vector(ch_R2W2_a, temp_a);
+	write_vector(ch_R2W2_b, temp_b);
 }
 
-__kernel void R2W2_write(__global       float* restrict c,
-                         __global       float* restrict d,
+__kernel void R2W2_write(__global       DTYPE* restrict c,
+                         __global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             pad_y,
@@ -314,8 +369,8 @@ __kernel void R2W2_write(__global       float* restrict c,
 	int gy = by + y - halo;
 	CHAN_WIDTH temp_a, temp_b;
 
-	temp_a = read_channel(ch_R2W2_a);
-	temp_b = read_channel(ch_R2W2_b);
+	read_vector(ch_R2W2_a, temp_a);
+	read_vector(ch_R2W2_b, temp_b);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -330,6 +385,146 @@ __kernel void R2W2_write(__global       float* restrict c,
 	}
 }
 
+//=======================
+// Read Zero - Write One
+//=======================
+__kernel void R0W1_read(const int             pad,
+                        const int             pad_x,
+                        const int             pad_y,
+                        const int             dim_x,
+                        const int             dim_y,
+                        const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_local_id(1);
+	int gidy = get_group_id(1);
+	int z = get_global_id(2);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int by = gidy * (BLOCK_Y - 2 * halo);
+	int gx = bx + x - halo;
+	int gy = by + y - halo;
+	CHAN_WIDTH temp;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+		{
+			temp.data[i] = (DTYPE)1;
+		}
+	}
+
+	write_vector(ch_R0W1, temp);
+}
+
+__kernel void R0W1_write(__global       DTYPE* restrict d,
+                                  const int             pad,
+                                  const int             pad_x,
+                                  const int             pad_y,
+                                  const int             dim_x,
+                                  const int             dim_y,
+                                  const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_local_id(1);
+	int gidy = get_group_id(1);
+	int z = get_global_id(2);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int by = gidy * (BLOCK_Y - 2 * halo);
+	int gx = bx + x - halo;
+	int gy = by + y - halo;
+	CHAN_WIDTH temp;
+
+	read_vector(ch_R0W1, temp);
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+		{
+			d[index] = temp.data[i];
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__kernel void R1W1IP_read(__global const DTYPE* restrict c,
+                                   const int             pad,
+                                   const int             pad_x,
+                                   const int             pad_y,
+                                   const int             dim_x,
+                                   const int             dim_y,
+                                   const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_local_id(1);
+	int gidy = get_group_id(1);
+	int z = get_global_id(2);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int by = gidy * (BLOCK_Y - 2 * halo);
+	int gx = bx + x - halo;
+	int gy = by + y - halo;
+	CHAN_WIDTH temp;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+		{
+			temp.data[i] = c[index];
+		}
+	}
+
+	write_vector(ch_R1W1IP, temp);
+}
+
+__kernel void R1W1IP_write(__global       DTYPE* restrict c,
+                                    const int             pad,
+                                    const int             pad_x,
+                                    const int             pad_y,
+                                    const int             dim_x,
+                                    const int             dim_y,
+                                    const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_local_id(1);
+	int gidy = get_group_id(1);
+	int z = get_global_id(2);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int by = gidy * (BLOCK_Y - 2 * halo);
+	int gx = bx + x - halo;
+	int gy = by + y - halo;
+	CHAN_WIDTH temp;
+
+	read_vector(ch_R1W1IP, temp);
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+		{
+			// halo indexes are only read, since they are written by the neighboring block
+			if (x + i >= halo && x + i < BLOCK_X - halo && y >= halo && y < BLOCK_Y - halo)
+			{
+				c[index] = temp.data[i] + (DTYPE)1;
+			}
+		}
+	}
+}
+
 //=====================================================================
 // Single Work-item Kernels
 //=====================================================================
@@ -339,7 +534,7 @@ __kernel void R2W2_write(__global       float* restrict c,
 // Read One - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1_read(__global const float* restrict a,
+__kernel void R1W1_read(__global const DTYPE* restrict a,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             pad_y,
@@ -377,7 +572,7 @@ __kernel void R1W1_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R1W1, temp);
+		write_vector(ch_R1W1, temp);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -406,7 +601,7 @@ __kernel void R1W1_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1_write(__global       float* restrict d,
+__kernel void R1W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             pad_y,
@@ -429,7 +624,7 @@ __kernel void R1W1_write(__global       float* restrict d,
 		cond++;
 
 		CHAN_WIDTH temp;
-		temp = read_channel(ch_R1W1);
+		read_vector(ch_R1W1, temp);
 
 		int gx = bx + x - halo;
 		int gy = by + y - halo;
@@ -475,8 +670,8 @@ __kernel void R1W1_write(__global       float* restrict d,
 // Read Two - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             pad_y,
@@ -515,8 +710,8 @@ __kernel void R2W1_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R2W1_a, temp_a);
-		write_channel(ch_R2W1_b, temp_b);
+		write_vector(ch_R2W1_a, temp_a);
+		write_vector(ch_R2W1_b, temp_b);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -545,7 +740,7 @@ __kernel void R2W1_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W1_write(__global       float* restrict d,
+__kernel void R2W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             pad_y,
@@ -568,8 +763,8 @@ __kernel void R2W1_write(__global       float* restrict d,
 		cond++;
 
 		CHAN_WIDTH temp_a, temp_b;
-		temp_a = read_channel(ch_R2W1_a);
-		temp_b = read_channel(ch_R2W1_b);
+		read_vector(ch_R2W1_a, temp_a);
+		read_vector(ch_R2W1_b, temp_b);
 
 		int gx = bx + x - halo;
 		int gy = by + y - halo;
@@ -615,9 +810,9 @@ __kernel void R2W1_write(__global       float* restrict d,
 // Read Three - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R3W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
-                        __global const float* restrict c,
+__kernel void R3W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
+                        __global const DTYPE* restrict c,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             pad_y,
@@ -657,9 +852,9 @@ __kernel void R3W1_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R3W1_a, temp_a);
-		write_channel(ch_R3W1_b, temp_b);
-		write_channel(ch_R3W1_c, temp_c);
+		write_vector(ch_R3W1_a, temp_a);
+		write_vector(ch_R3W1_b, temp_b);
+		write_vector(ch_R3W1_c, temp_c);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -688,7 +883,7 @@ __kernel void R3W1_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R3W1_write(__global       float* restrict d,
+__kernel void R3W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             pad_y,
@@ -711,9 +906,9 @@ __kernel void R3W1_write(__global       float* restrict d,
 		cond++;
 
 		CHAN_WIDTH temp_a, temp_b, temp_c;
-		temp_a = read_channel(ch_R3W1_a);
-		temp_b = read_channel(ch_R3W1_b);
-		temp_c = read_channel(ch_R3W1_c);
+		read_vector(ch_R3W1_a, temp_a);
+		read_vector(ch_R3W1_b, temp_b);
+		read_vector(ch_R3W1_c, temp_c);
 
 		int gx = bx + x - halo;
 		int gy = by + y - halo;
@@ -759,8 +954,8 @@ __kernel void R3W1_write(__global       float* restrict d,
 // Read Two - Write Two
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W2_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W2_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const int             pad_x,
                                  const int             pad_y,
@@ -799,8 +994,8 @@ __kernel void R2W2_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R2W2_a, temp_a);
-		write_channel(ch_R2W2_b, temp_b);
+		write_vector(ch_R2W2_a, temp_a);
+		write_vector(ch_R2W2_b, temp_b);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -829,8 +1024,8 @@ __kernel void R2W2_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W2_write(__global       float* restrict c,
-                         __global       float* restrict d,
+__kernel void R2W2_write(__global       DTYPE* restrict c,
+                         __global       DTYPE* restrict d,
                                   const int             pad,
                                   const int             pad_x,
                                   const int             pad_y,
@@ -853,8 +1048,8 @@ __kernel void R2W2_write(__global       float* restrict c,
 		cond++;
 
 		CHAN_WIDTH temp_a, temp_b;
-		temp_a = read_channel(ch_R2W2_a);
-		temp_b = read_channel(ch_R2W2_b);
+		read_vector(ch_R2W2_a, temp_a);
+		read_vector(ch_R2W2_b, temp_b);
 
 		int gx = bx + x - halo;
 		int gy = by + y - halo;
@@ -897,4 +1092,527 @@ __kernel void R2W2_write(__global       float* restrict c,
 	}
 }
 
-#endif
\ No newline at end of file
+//=======================
+// Read Zero - Write One
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R0W1_read(const int             pad,
+                        const int             pad_x,
+                        const int             pad_y,
+                        const int             dim_x,
+                        const int             dim_y,
+                        const int             dim_z,
+                        const int             x_exit,
+                        const long            loop_exit,
+                        const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int bx = 0;
+	int by = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+
+		int gx = bx + x - halo;
+		int gy = by + y - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+			{
+				temp.data[i] = (DTYPE)1;
+			}
+		}
+
+		write_vector(ch_R0W1, temp);
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y = (y + 1) & (BLOCK_Y - 1);
+
+			if (y == 0)
+			{
+				z++;
+
+				if (z == dim_z)
+				{
+					z = 0;
+					bx += BLOCK_X - 2 * halo;
+
+					if (bx == x_exit)
+					{
+						bx = 0;
+						by += BLOCK_Y - 2 * halo;
+					}
+				}
+			}
+		}
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void R0W1_write(__global       DTYPE* restrict d,
+                                  const int             pad,
+                                  const int             pad_x,
+                                  const int             pad_y,
+                                  const int             dim_x,
+                                  const int             dim_y,
+                                  const int             dim_z,
+                                  const int             x_exit,
+                                  const long            loop_exit,
+                                  const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int bx = 0;
+	int by = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+		read_vector(ch_R0W1, temp);
+
+		int gx = bx + x - halo;
+		int gy = by + y - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+			{
+				d[index] = temp.data[i];
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y = (y + 1) & (BLOCK_Y - 1);
+
+			if (y == 0)
+			{
+				z++;
+
+				if (z == dim_z)
+				{
+					z = 0;
+					bx += BLOCK_X - 2 * halo;
+
+					if (bx == x_exit)
+					{
+						bx = 0;
+						by += BLOCK_Y - 2 * halo;
+					}
+				}
+			}
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1IP_read(__global const DTYPE* restrict c,
+                                   const int             pad,
+                                   const int             pad_x,
+                                   const int             pad_y,
+                                   const int             dim_x,
+                                   const int             dim_y,
+                                   const int             dim_z,
+                                   const int             x_exit,
+                                   const long            loop_exit,
+                                   const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int bx = 0;
+	int by = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+
+		int gx = bx + x - halo;
+		int gy = by + y - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+			{
+				temp.data[i] = c[index];
+			}
+		}
+
+		write_vector(ch_R1W1IP, temp);
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y = (y + 1) & (BLOCK_Y - 1);
+
+			if (y == 0)
+			{
+				z++;
+
+				if (z == dim_z)
+				{
+					z = 0;
+					bx += BLOCK_X - 2 * halo;
+
+					if (bx == x_exit)
+					{
+						bx = 0;
+						by += BLOCK_Y - 2 * halo;
+					}
+				}
+			}
+		}
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1IP_write(__global       DTYPE* restrict c,
+                                    const int             pad,
+                                    const int             pad_x,
+                                    const int             pad_y,
+                                    const int             dim_x,
+                                    const int             dim_y,
+                                    const int             dim_z,
+                                    const int             x_exit,
+                                    const long            loop_exit,
+                                    const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int bx = 0;
+	int by = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+		read_vector(ch_R1W1IP, temp);
+
+		int gx = bx + x - halo;
+		int gy = by + y - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+			{
+				// halo indexes are only read, since they are written by the neighboring block
+				if (x + i >= halo && x + i < BLOCK_X - halo && y >= halo && y < BLOCK_Y - halo)
+				{
+					c[index] = temp.data[i] + (DTYPE)1;
+				}
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y = (y + 1) & (BLOCK_Y - 1);
+
+			if (y == 0)
+			{
+				z++;
+
+				if (z == dim_z)
+				{
+					z = 0;
+					bx += BLOCK_X - 2 * halo;
+
+					if (bx == x_exit)
+					{
+						bx = 0;
+						by += BLOCK_Y - 2 * halo;
+					}
+				}
+			}
+		}
+	}
+}
+
+#endif
+
+#else
+
+#include "fpga-mem-bench-kernel-rw.h"
+
+channel CHAN_WORD ch_RW[RW_CHANNELS] __attribute__((depth(DEPTH)));
+
+//=====================================================================
+// Generated Kernels
+//=====================================================================
+#ifdef NDR
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__kernel void RW_READ(RW_INPUTS
+                               const int             pad,
+                               const int             pad_x,
+                               const int             pad_y,
+                               const int             dim_x,
+                               const int             dim_y,
+                               const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_local_id(1);
+	int gidy = get_group_id(1);
+	int z = get_global_id(2);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int by = gidy * (BLOCK_Y - 2 * halo);
+	int gx = bx + x - halo;
+	int gy = by + y - halo;
+	CHAN_WIDTH temp[RW_CHANNELS];
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+		{
+			RW_GET(temp, i, index);
+		}
+	}
+
+	#pragma unroll
+	for (int j = 0; j < RW_CHANNELS; j++)
+	{
+		write_vector(ch_RW[j], temp[j]);
+	}
+}
+
+__kernel void RW_WRITE(RW_OUTPUTS
+                                const int             pad,
+                                const int             pad_x,
+                                const int             pad_y,
+                                const int             dim_x,
+                                const int             dim_y,
+                                const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	int y = get_local_id(1);
+	int gidy = get_group_id(1);
+	int z = get_global_id(2);
+	int bx = gidx * (BLOCK_X - 2 * halo);
+	int by = gidy * (BLOCK_Y - 2 * halo);
+	int gx = bx + x - halo;
+	int gy = by + y - halo;
+	CHAN_WIDTH temp[RW_CHANNELS];
+
+	#pragma unroll
+	for (int j = 0; j < RW_CHANNELS; j++)
+	{
+		read_vector(ch_RW[j], temp[j]);
+	}
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		int real_x = gx + i;
+		long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+		if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+		{
+			DTYPE value = temp[0].data[i];
+			#pragma unroll
+			for (int j = 1; j < RW_CHANNELS; j++)
+			{
+				value += temp[j].data[i];
+			}
+			RW_PUT(index, value);
+		}
+	}
+}
+
+#else
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void RW_READ(RW_INPUTS
+                               const int             pad,
+                               const int             pad_x,
+                               const int             pad_y,
+                               const int             dim_x,
+                               const int             dim_y,
+                               const int             dim_z,
+                               const int             x_exit,
+                               const long            loop_exit,
+                               const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int bx = 0;
+	int by = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp[RW_CHANNELS];
+
+		int gx = bx + x - halo;
+		int gy = by + y - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+			{
+				RW_GET(temp, i, index);
+			}
+		}
+
+		#pragma unroll
+		for (int j = 0; j < RW_CHANNELS; j++)
+		{
+			write_vector(ch_RW[j], temp[j]);
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y = (y + 1) & (BLOCK_Y - 1);
+
+			if (y == 0)
+			{
+				z++;
+
+				if (z == dim_z)
+				{
+					z = 0;
+					bx += BLOCK_X - 2 * halo;
+
+					if (bx == x_exit)
+					{
+						bx = 0;
+						by += BLOCK_Y - 2 * halo;
+					}
+				}
+			}
+		}
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void RW_WRITE(RW_OUTPUTS
+                                const int             pad,
+                                const int             pad_x,
+                                const int             pad_y,
+                                const int             dim_x,
+                                const int             dim_y,
+                                const int             dim_z,
+                                const int             x_exit,
+                                const long            loop_exit,
+                                const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int bx = 0;
+	int by = 0;
+
+	while (cond != loop_exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp[RW_CHANNELS];
+		#pragma unroll
+		for (int j = 0; j < RW_CHANNELS; j++)
+		{
+			read_vector(ch_RW[j], temp[j]);
+		}
+
+		int gx = bx + x - halo;
+		int gy = by + y - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			int real_x = gx + i;
+			long index = pad + z * (pad_x + dim_x) * (pad_y + dim_y) + (gy + pad_y) * (pad_x + dim_x) + (pad_x + real_x);
+
+			if (real_x >= 0 && gy >= 0 && real_x < dim_x && gy < dim_y)
+			{
+				DTYPE value = temp[0].data[i];
+				#pragma unroll
+				for (int j = 1; j < RW_CHANNELS; j++)
+				{
+					value += temp[j].data[i];
+				}
+				RW_PUT(index, value);
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			y = (y + 1) & (BLOCK_Y - 1);
+
+			if (y == 0)
+			{
+				z++;
+
+				if (z == dim_z)
+				{
+					z = 0;
+					bx += BLOCK_X - 2 * halo;
+
+					if (bx == x_exit)
+					{
+						bx = 0;
+						by += BLOCK_Y - 2 * halo;
+					}
+				}
+			}
+		}
+	}
+}
+
+#endif
+
+#endif // READS
@@ -0,0 +1,209 @@
+//====================================================================================================================================
+// Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Channelized compute pipeline
+// FMA_read streams buffer a to FMA_compute, which applies a chain of "fmas" dependent FMAs, x = fma(x, FMA_MUL, FMA_ADD), to every
+// element and streams the results to FMA_write, which writes them to buffer d; the three kernels run concurrently, connected by
+// channels, so that the arithmetic intensity of the pipeline can be swept while the memory traffic stays the same
+// The chain of FMAS FMAs per element is fully unrolled and the FMAs beyond "fmas" are predicated off, so the compute kernel accepts
+// a vector every cycle whatever the chain length; one kernel binary covers every chain length up to FMAS
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef DEPTH
+	#define DEPTH 16
+#endif
+
+#ifndef FMAS
+	#define FMAS 16
+#endif
+
+// the chain converges to 1.0 from any input, so that long chains neither overflow nor lose every bit of the input
+#define FMA_MUL 0.999f
+#define FMA_ADD 0.001f
+
+#define WGS 64
+
+// channels carry words of CHAN_VEC elements, VEC by default; narrower channels take VEC / CHAN_VEC words per vector
+#ifndef CHAN_VEC
+	#define CHAN_VEC VEC
+#endif
+#if VEC % CHAN_VEC != 0
+	#error "VEC must be a multiple of CHAN_VEC"
+#endif
+
+typedef struct
+{
+	float data[VEC];
+} CHAN_WIDTH;
+
+typedef struct
+{
+	float data[CHAN_VEC];
+} CHAN_WORD;
+
+// send or receive a vector as consecutive channel words
+#define write_vector(ch, vector)                                                   \
+	_Pragma("unroll")                                                              \
+	for (int chan_w = 0; chan_w < VEC / CHAN_VEC; chan_w++)                        \
+	{                                                                              \
+		CHAN_WORD chan_word;                                                       \
+		_Pragma("unroll")                                                          \
+		for (int chan_i = 0; chan_i < CHAN_VEC; chan_i++)                          \
+		{                                                                          \
+			chan_word.data[chan_i] = (vector).data[chan_w * CHAN_VEC + chan_i];    \
+		}                                                                          \
+		write_channel(ch, chan_word);                                              \
+	}
+
+#define read_vector(ch, vector)                                                    \
+	_Pragma("unroll")                                                              \
+	for (int chan_w = 0; chan_w < VEC / CHAN_VEC; chan_w++)                        \
+	{                                                                              \
+		CHAN_WORD chan_word = read_channel(ch);                                    \
+		_Pragma("unroll")                                                          \
+		for (int chan_i = 0; chan_i < CHAN_VEC; chan_i++)                          \
+		{                                                                          \
+			(vector).data[chan_w * CHAN_VEC + chan_i] = chan_word.data[chan_i];    \
+		}                                                                          \
+	}
+
+channel CHAN_WORD ch_FMA_in  __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_FMA_out __attribute__((depth(DEPTH)));
+
+// Applies the first "fmas" FMAs of the chain to every element of a vector
+inline CHAN_WIDTH fma_chain(CHAN_WIDTH in, const int fmas)
+{
+	CHAN_WIDTH out;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		float x = in.data[i];
+
+		#pragma unroll
+		for (int s = 0; s < FMAS; s++)
+		{
+			x = (s < fmas) ? fma(x, FMA_MUL, FMA_ADD) : x;
+		}
+
+		out.data[i] = x;
+	}
+
+	return out;
+}
+
+// all three kernels take the same arguments after their buffers, so that the host sets them alike
+
+//=====================================================================
+// NDRange Kernels
+//=====================================================================
+#ifdef NDR
+
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void FMA_read(__global const float* restrict a,
+                                const int             pad,
+                                const long            groups,
+                                const int             fmas)
+{
+	long group = get_global_id(0);
+	CHAN_WIDTH temp;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		temp.data[i] = a[pad + group * VEC + i];
+	}
+
+	write_vector(ch_FMA_in, temp);
+}
+
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void FMA_compute(const int  pad,
+                          const long groups,
+                          const int  fmas)
+{
+	CHAN_WIDTH temp;
+
+	read_vector(ch_FMA_in, temp);
+	temp = fma_chain(temp, fmas);
+	write_vector(ch_FMA_out, temp);
+}
+
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void FMA_write(__global       float* restrict d,
+                                 const int             pad,
+                                 const long            groups,
+                                 const int             fmas)
+{
+	long group = get_global_id(0);
+	CHAN_WIDTH temp;
+
+	read_vector(ch_FMA_out, temp);
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		d[pad + group * VEC + i] = temp.data[i];
+	}
+}
+
+//=====================================================================
+// Single Work-item Kernels
+//=====================================================================
+#else
+
+__attribute__((max_global_work_dim(0)))
+__kernel void FMA_read(__global const float* restrict a,
+                                const int             pad,
+                                const long            groups,
+                                const int             fmas)
+{
+	for (long group = 0; group < groups; group++)
+	{
+		CHAN_WIDTH temp;
+
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			temp.data[i] = a[pad + group * VEC + i];
+		}
+
+		write_vector(ch_FMA_in, temp);
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void FMA_compute(const int  pad,
+                          const long groups,
+                          const int  fmas)
+{
+	for (long group = 0; group < groups; group++)
+	{
+		CHAN_WIDTH temp;
+
+		read_vector(ch_FMA_in, temp);
+		temp = fma_chain(temp, fmas);
+		write_vector(ch_FMA_out, temp);
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void FMA_write(__global       float* restrict d,
+                                 const int             pad,
+                                 const long            groups,
+                                 const int             fmas)
+{
+	for (long group = 0; group < groups; group++)
+	{
+		CHAN_WIDTH temp;
+
+		read_vector(ch_FMA_out, temp);
+
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			d[pad + group * VEC + i] = temp.data[i];
+		}
+	}
+}
+
+#endif
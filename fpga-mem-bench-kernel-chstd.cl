@@ -1,8 +1,20 @@
 //====================================================================================================================================
 // Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Channelized
+// With READS defined, only the kernels generated from fpga-mem-bench-kernel-rw.h are compiled, with READS inputs and WRITES outputs
 // (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
 //====================================================================================================================================
 
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
 #ifdef LEGACY
 	#pragma OPENCL EXTENSION cl_altera_channels : enable
 	#define read_channel read_channel_altera
@@ -17,20 +29,63 @@
 	#define DEPTH 16
 #endif
 
+// channels carry words of CHAN_VEC elements, VEC by default; narrower channels take VEC / CHAN_VEC words per vector
+#ifndef CHAN_VEC
+	#define CHAN_VEC VEC
+#endif
+#if VEC % CHAN_VEC != 0
+	#error "VEC must be a multiple of CHAN_VEC"
+#endif
+
 typedef struct
 {
-	float data[VEC];
+	DTYPE data[VEC];
 } CHAN_WIDTH;
 
-channel CHAN_WIDTH ch_R1W0   __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R1W1   __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W1_a __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W1_b __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R3W1_a __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R3W1_b __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R3W1_c __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W2_a __attribute__((depth(DEPTH)));
-channel CHAN_WIDTH ch_R2W2_b __attribute__((depth(DEPTH)));
+typedef struct
+{
+	DTYPE data[CHAN_VEC];
+} CHAN_WORD;
+
+// send or receive a vector as consecutive channel words
+#define write_vector(ch, vector)                                                   \
+	_Pragma("unroll")                                                              \
+	for (int chan_w = 0; chan_w < VEC / CHAN_VEC; chan_w++)                        \
+	{                                                                              \
+		CHAN_WORD chan_word;                                                       \
+		_Pragma("unroll")                                                          \
+		for (int chan_i = 0; chan_i < CHAN_VEC; chan_i++)                          \
+		{                                                                          \
+			chan_word.data[chan_i] = (vector).data[chan_w * CHAN_VEC + chan_i];    \
+		}                                                                          \
+		write_channel(ch, chan_word);                                              \
+	}
+
+#define read_vector(ch, vector)                                                    \
+	_Pragma("unroll")                                                              \
+	for (int chan_w = 0; chan_w < VEC / CHAN_VEC; chan_w++)                        \
+	{                                                                              \
+		CHAN_WORD chan_word = read_channel(ch);                                    \
+		_Pragma("unroll")                                                          \
+		for (int chan_i = 0; chan_i < CHAN_VEC; chan_i++)                          \
+		{                                                                          \
+			(vector).data[chan_w * CHAN_VEC + chan_i] = chan_word.data[chan_i];    \
+		}                                                                          \
+	}
+
+#ifndef READS
+
+channel CHAN_WORD ch_R1W0   __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R1W1   __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W1_a __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W1_b __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R3W1_a __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R3W1_b __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R3W1_c __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W2_a __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R2W2_b __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R0W1   __attribute__((depth(DEPTH)));
+channel CHAN_WORD ch_R1W1IP __attribute__((depth(DEPTH)));
 
 //=====================================================================
 // NDRange Kernels
@@ -41,7 +96,7 @@ channel CHAN_WIDTH ch_R2W2_b __attribute__((depth(DEPTH)));
 // Read One - Write Zero
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R1W0_read(__global const float* restrict a,
+__kernel void R1W0_read(__global const DTYPE* restrict a,
                                  const int             pad,
                                  const long            dim_x,
                                  const int             halo)
@@ -66,12 +121,12 @@ __kernel void R1W0_read(__global const float* restrict a,
 	// to prevent the compiler from optimizing out the memory accesses
 	if (x == 0 && gidx == 0)
 	{
-		write_channel(ch_R1W0, temp);
+		write_vector(ch_R1W0, temp);
 	}
 }
 
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R1W0_write(__global       float* restrict d)
+__kernel void R1W0_write(__global       DTYPE* restrict d)
 {
 	int x = get_local_id(0) * VEC;
 	int gidx = get_group_id(0);
@@ -80,7 +135,7 @@ __kernel void R1W0_write(__global       float* restrict d)
 	// to prevent the compiler from optimizing out the memory accesses
 	if (x == 0 && gidx == 0)
 	{
-		temp = read_channel(ch_R1W0);
+		read_vector(ch_R1W0, temp);
 
 		#pragma unroll
 		for (int i = 0; i < VEC; i++)
@@ -94,7 +149,7 @@ __kernel void R1W0_write(__global       float* restrict d)
 // Read One - Write One
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R1W1_read(__global const float* restrict a,
+__kernel void R1W1_read(__global const DTYPE* restrict a,
                                  const int             pad,
                                  const long            dim_x,
                                  const int             halo)
@@ -116,11 +171,11 @@ __kernel void R1W1_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R1W1, temp);
+	write_vector(ch_R1W1, temp);
 }
 
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R1W1_write(__global       float* restrict d,
+__kernel void R1W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const long            dim_x,
                                   const int             halo)
@@ -131,7 +186,7 @@ __kernel void R1W1_write(__global       float* restrict d,
 	long gx = bx + x - halo;
 	CHAN_WIDTH temp;
 
-	temp = read_channel(ch_R1W1);
+	read_vector(ch_R1W1, temp);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -149,8 +204,8 @@ __kernel void R1W1_write(__global       float* restrict d,
 // Read Two - Write One
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R2W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const long            dim_x,
                                  const int             halo)
@@ -173,12 +228,12 @@ __kernel void R2W1_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R2W1_a, temp_a);
-	write_channel(ch_R2W1_b, temp_b);
+	write_vector(ch_R2W1_a, temp_a);
+	write_vector(ch_R2W1_b, temp_b);
 }
 
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R2W1_write(__global       float* restrict d,
+__kernel void R2W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const long            dim_x,
                                   const int             halo)
@@ -189,8 +244,8 @@ __kernel void R2W1_write(__global       float* restrict d,
 	long gx = bx + x - halo;
 	CHAN_WIDTH temp_a, temp_b;
 
-	temp_a = read_channel(ch_R2W1_a);
-	temp_b = read_channel(ch_R2W1_b);
+	read_vector(ch_R2W1_a, temp_a);
+	read_vector(ch_R2W1_b, temp_b);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -208,9 +263,9 @@ __kernel void R2W1_write(__global       float* restrict d,
 // Read Three - Write One
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R3W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
-                        __global const float* restrict c,
+__kernel void R3W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
+                        __global const DTYPE* restrict c,
                                  const int             pad,
                                  const long            dim_x,
                                  const int             halo)
@@ -234,13 +289,13 @@ __kernel void R3W1_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R3W1_a, temp_a);
-	write_channel(ch_R3W1_b, temp_b);
-	write_channel(ch_R3W1_c, temp_c);
+	write_vector(ch_R3W1_a, temp_a);
+	write_vector(ch_R3W1_b, temp_b);
+	write_vector(ch_R3W1_c, temp_c);
 }
 
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R3W1_write(__global       float* restrict d,
+__kernel void R3W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const long            dim_x,
                                   const int             halo)
@@ -251,9 +306,9 @@ __kernel void R3W1_write(__global       float* restrict d,
 	long gx = bx + x - halo;
 	CHAN_WIDTH temp_a, temp_b, temp_c;
 
-	temp_a = read_channel(ch_R3W1_a);
-	temp_b = read_channel(ch_R3W1_b);
-	temp_c = read_channel(ch_R3W1_c);
+	read_vector(ch_R3W1_a, temp_a);
+	read_vector(ch_R3W1_b, temp_b);
+	read_vector(ch_R3W1_c, temp_c);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -271,8 +326,8 @@ __kernel void R3W1_write(__global       float* restrict d,
 // Read Two - Write Two
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R2W2_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W2_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const long            dim_x,
                                  const int             halo)
@@ -295,13 +350,13 @@ __kernel void R2W2_read(__global const float* restrict a,
 		}
 	}
 
-	write_channel(ch_R2W2_a, temp_a);
-	write_channel(ch_R2W2_b, temp_b);
+	write_vector(ch_R2W2_a, temp_a);
+	write_vector(ch_R2W2_b, temp_b);
 }
 
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R2W2_write(__global       float* restrict c,
-                         __global       float* restrict d,
+__kernel void R2W2_write(__global       DTYPE* restrict c,
+                         __global       DTYPE* restrict d,
                                   const int             pad,
                                   const long            dim_x,
                                   const int             halo)
@@ -312,8 +367,8 @@ __kernel void R2W2_write(__global       float* restrict c,
 	long gx = bx + x - halo;
 	CHAN_WIDTH temp_a, temp_b;
 
-	temp_a = read_channel(ch_R2W2_a);
-	temp_b = read_channel(ch_R2W2_b);
+	read_vector(ch_R2W2_a, temp_a);
+	read_vector(ch_R2W2_b, temp_b);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -328,6 +383,118 @@ __kernel void R2W2_write(__global       float* restrict c,
 	}
 }
 
+//=======================
+// Read Zero - Write One
+//=======================
+__attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
+__kernel void R0W1_read(const int             pad,
+                        const long            dim_x,
+                        const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	long bx = gidx * (BLOCK_X - 2 * halo);
+	long gx = bx + x - halo;
+	CHAN_WIDTH temp;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long real_x = gx + i;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			temp.data[i] = (DTYPE)1;
+		}
+	}
+
+	write_vector(ch_R0W1, temp);
+}
+
+__attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
+__kernel void R0W1_write(__global       DTYPE* restrict d,
+                                  const int             pad,
+                                  const long            dim_x,
+                                  const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	long bx = gidx * (BLOCK_X - 2 * halo);
+	long gx = bx + x - halo;
+	CHAN_WIDTH temp;
+
+	read_vector(ch_R0W1, temp);
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long real_x = gx + i;
+		long index = pad + real_x;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			d[index] = temp.data[i];
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
+__kernel void R1W1IP_read(__global const DTYPE* restrict c,
+                                   const int             pad,
+                                   const long            dim_x,
+                                   const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	long bx = gidx * (BLOCK_X - 2 * halo);
+	long gx = bx + x - halo;
+	CHAN_WIDTH temp;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long real_x = gx + i;
+		long index = pad + real_x;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			temp.data[i] = c[index];
+		}
+	}
+
+	write_vector(ch_R1W1IP, temp);
+}
+
+__attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
+__kernel void R1W1IP_write(__global       DTYPE* restrict c,
+                                    const int             pad,
+                                    const long            dim_x,
+                                    const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	long bx = gidx * (BLOCK_X - 2 * halo);
+	long gx = bx + x - halo;
+	CHAN_WIDTH temp;
+
+	read_vector(ch_R1W1IP, temp);
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long real_x = gx + i;
+		long index = pad + real_x;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			// halo indexes are only read, since they are written by the neighboring block
+			if (x + i >= halo && x + i < BLOCK_X - halo)
+			{
+				c[index] = temp.data[i] + (DTYPE)1;
+			}
+		}
+	}
+}
+
 //=====================================================================
 // Single Work-item Kernels
 //=====================================================================
@@ -337,7 +504,7 @@ __kernel void R2W2_write(__global       float* restrict c,
 // Read One - Write Zero
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W0_read(__global const float* restrict a,
+__kernel void R1W0_read(__global const DTYPE* restrict a,
                                  const int             pad,
                                  const long            dim_x,
                                  const long            exit,
@@ -372,7 +539,7 @@ __kernel void R1W0_read(__global const float* restrict a,
 			// to prevent the compiler from optimizing out the memory accesses
 			if (bx == 0)
 			{
-				write_channel(ch_R1W0, temp);
+				write_vector(ch_R1W0, temp);
 			}
 			bx += BLOCK_X - 2 * halo;
 		}
@@ -380,10 +547,10 @@ __kernel void R1W0_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W0_write(__global float* restrict d)
+__kernel void R1W0_write(__global DTYPE* restrict d)
 {
 	CHAN_WIDTH temp;
-	temp = read_channel(ch_R1W0);
+	read_vector(ch_R1W0, temp);
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -396,7 +563,7 @@ __kernel void R1W0_write(__global float* restrict d)
 // Read One - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1_read(__global const float* restrict a,
+__kernel void R1W1_read(__global const DTYPE* restrict a,
                                  const int             pad,
                                  const long            dim_x,
                                  const long            exit,
@@ -424,7 +591,7 @@ __kernel void R1W1_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R1W1, temp);
+		write_vector(ch_R1W1, temp);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -436,7 +603,7 @@ __kernel void R1W1_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1_write(__global       float* restrict d,
+__kernel void R1W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const long            dim_x,
                                   const long            exit,
@@ -451,7 +618,7 @@ __kernel void R1W1_write(__global       float* restrict d,
 		cond++;
 
 		CHAN_WIDTH temp;
-		temp = read_channel(ch_R1W1);
+		read_vector(ch_R1W1, temp);
 
 		long gx = bx + x - halo;
 		#pragma unroll
@@ -478,8 +645,8 @@ __kernel void R1W1_write(__global       float* restrict d,
 // Read Two - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const long            dim_x,
                                  const long            exit,
@@ -508,8 +675,8 @@ __kernel void R2W1_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R2W1_a, temp_a);
-		write_channel(ch_R2W1_b, temp_b);
+		write_vector(ch_R2W1_a, temp_a);
+		write_vector(ch_R2W1_b, temp_b);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -521,7 +688,7 @@ __kernel void R2W1_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W1_write(__global       float* restrict d,
+__kernel void R2W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const long            dim_x,
                                   const long            exit,
@@ -536,8 +703,8 @@ __kernel void R2W1_write(__global       float* restrict d,
 		cond++;
 
 		CHAN_WIDTH temp_a, temp_b;
-		temp_a = read_channel(ch_R2W1_a);
-		temp_b = read_channel(ch_R2W1_b);
+		read_vector(ch_R2W1_a, temp_a);
+		read_vector(ch_R2W1_b, temp_b);
 
 		long gx = bx + x - halo;
 		#pragma unroll
@@ -564,9 +731,9 @@ __kernel void R2W1_write(__global       float* restrict d,
 // Read Three - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R3W1_read(__global const float* restrict a,
-                        __global const float* restrict b,
-                        __global const float* restrict c,
+__kernel void R3W1_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
+                        __global const DTYPE* restrict c,
                                  const int             pad,
                                  const long            dim_x,
                                  const long            exit,
@@ -596,9 +763,9 @@ __kernel void R3W1_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R3W1_a, temp_a);
-		write_channel(ch_R3W1_b, temp_b);
-		write_channel(ch_R3W1_c, temp_c);
+		write_vector(ch_R3W1_a, temp_a);
+		write_vector(ch_R3W1_b, temp_b);
+		write_vector(ch_R3W1_c, temp_c);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -610,7 +777,7 @@ __kernel void R3W1_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R3W1_write(__global       float* restrict d,
+__kernel void R3W1_write(__global       DTYPE* restrict d,
                                   const int             pad,
                                   const long            dim_x,
                                   const long            exit,
@@ -625,9 +792,9 @@ __kernel void R3W1_write(__global       float* restrict d,
 		cond++;
 
 		CHAN_WIDTH temp_a, temp_b, temp_c;
-		temp_a = read_channel(ch_R3W1_a);
-		temp_b = read_channel(ch_R3W1_b);
-		temp_c = read_channel(ch_R3W1_c);
+		read_vector(ch_R3W1_a, temp_a);
+		read_vector(ch_R3W1_b, temp_b);
+		read_vector(ch_R3W1_c, temp_c);
 
 		long gx = bx + x - halo;
 		#pragma unroll
@@ -654,8 +821,8 @@ __kernel void R3W1_write(__global       float* restrict d,
 // Read Two - Write Two
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W2_read(__global const float* restrict a,
-                        __global const float* restrict b,
+__kernel void R2W2_read(__global const DTYPE* restrict a,
+                        __global const DTYPE* restrict b,
                                  const int             pad,
                                  const long            dim_x,
                                  const long            exit,
@@ -684,8 +851,8 @@ __kernel void R2W2_read(__global const float* restrict a,
 			}
 		}
 
-		write_channel(ch_R2W2_a, temp_a);
-		write_channel(ch_R2W2_b, temp_b);
+		write_vector(ch_R2W2_a, temp_a);
+		write_vector(ch_R2W2_b, temp_b);
 
 		x = (x + VEC) & (BLOCK_X - 1);
 
@@ -697,8 +864,8 @@ __kernel void R2W2_read(__global const float* restrict a,
 }
 
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W2_write(__global       float* restrict c,
-                         __global       float* restrict d,
+__kernel void R2W2_write(__global       DTYPE* restrict c,
+                         __global       DTYPE* restrict d,
                                   const int             pad,
                                   const long            dim_x,
                                   const long            exit,
@@ -713,8 +880,8 @@ __kernel void R2W2_write(__global       float* restrict c,
 		cond++;
 
 		CHAN_WIDTH temp_a, temp_b;
-		temp_a = read_channel(ch_R2W2_a);
-		temp_b = read_channel(ch_R2W2_b);
+		read_vector(ch_R2W2_a, temp_a);
+		read_vector(ch_R2W2_b, temp_b);
 
 		long gx = bx + x - halo;
 		#pragma unroll
@@ -738,4 +905,352 @@ __kernel void R2W2_write(__global       float* restrict c,
 	}
 }
 
-#endif
\ No newline at end of file
+//=======================
+// Read Zero - Write One
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R0W1_read(const int             pad,
+                        const long            dim_x,
+                        const long            exit,
+                        const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	long bx = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+
+		long gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long real_x = gx + i;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				temp.data[i] = (DTYPE)1;
+			}
+		}
+
+		write_vector(ch_R0W1, temp);
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			bx += BLOCK_X - 2 * halo;
+		}
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void R0W1_write(__global       DTYPE* restrict d,
+                                  const int             pad,
+                                  const long            dim_x,
+                                  const long            exit,
+                                  const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	long bx = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+		read_vector(ch_R0W1, temp);
+
+		long gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long real_x = gx + i;
+			long index = pad + real_x;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				d[index] = temp.data[i];
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			bx += BLOCK_X - 2 * halo;
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1IP_read(__global const DTYPE* restrict c,
+                                   const int             pad,
+                                   const long            dim_x,
+                                   const long            exit,
+                                   const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	long bx = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+
+		long gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long real_x = gx + i;
+			long index = pad + real_x;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				temp.data[i] = c[index];
+			}
+		}
+
+		write_vector(ch_R1W1IP, temp);
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			bx += BLOCK_X - 2 * halo;
+		}
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1IP_write(__global       DTYPE* restrict c,
+                                    const int             pad,
+                                    const long            dim_x,
+                                    const long            exit,
+                                    const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	long bx = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp;
+		read_vector(ch_R1W1IP, temp);
+
+		long gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long real_x = gx + i;
+			long index = pad + real_x;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				// halo indexes are only read, since they are written by the neighboring block
+				if (x + i >= halo && x + i < BLOCK_X - halo)
+				{
+					c[index] = temp.data[i] + (DTYPE)1;
+				}
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			bx += BLOCK_X - 2 * halo;
+		}
+	}
+}
+
+#endif
+
+#else
+
+#include "fpga-mem-bench-kernel-rw.h"
+
+channel CHAN_WORD ch_RW[RW_CHANNELS] __attribute__((depth(DEPTH)));
+
+//=====================================================================
+// Generated Kernels
+//=====================================================================
+#ifdef NDR
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
+__kernel void RW_READ(RW_INPUTS
+                               const int             pad,
+                               const long            dim_x,
+                               const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	long bx = gidx * (BLOCK_X - 2 * halo);
+	long gx = bx + x - halo;
+	CHAN_WIDTH temp[RW_CHANNELS];
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long real_x = gx + i;
+		long index = pad + real_x;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			RW_GET(temp, i, index);
+		}
+	}
+
+	#pragma unroll
+	for (int j = 0; j < RW_CHANNELS; j++)
+	{
+		write_vector(ch_RW[j], temp[j]);
+	}
+}
+
+__attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
+__kernel void RW_WRITE(RW_OUTPUTS
+                                const int             pad,
+                                const long            dim_x,
+                                const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	long bx = gidx * (BLOCK_X - 2 * halo);
+	long gx = bx + x - halo;
+	CHAN_WIDTH temp[RW_CHANNELS];
+
+	#pragma unroll
+	for (int j = 0; j < RW_CHANNELS; j++)
+	{
+		read_vector(ch_RW[j], temp[j]);
+	}
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long real_x = gx + i;
+		long index = pad + real_x;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			DTYPE value = temp[0].data[i];
+			#pragma unroll
+			for (int j = 1; j < RW_CHANNELS; j++)
+			{
+				value += temp[j].data[i];
+			}
+			RW_PUT(index, value);
+		}
+	}
+}
+
+#else
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void RW_READ(RW_INPUTS
+                               const int             pad,
+                               const long            dim_x,
+                               const long            exit,
+                               const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	long bx = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp[RW_CHANNELS];
+
+		long gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long real_x = gx + i;
+			long index = pad + real_x;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				RW_GET(temp, i, index);
+			}
+		}
+
+		#pragma unroll
+		for (int j = 0; j < RW_CHANNELS; j++)
+		{
+			write_vector(ch_RW[j], temp[j]);
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			bx += BLOCK_X - 2 * halo;
+		}
+	}
+}
+
+__attribute__((max_global_work_dim(0)))
+__kernel void RW_WRITE(RW_OUTPUTS
+                                const int             pad,
+                                const long            dim_x,
+                                const long            exit,
+                                const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	long bx = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		CHAN_WIDTH temp[RW_CHANNELS];
+		#pragma unroll
+		for (int j = 0; j < RW_CHANNELS; j++)
+		{
+			read_vector(ch_RW[j], temp[j]);
+		}
+
+		long gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long real_x = gx + i;
+			long index = pad + real_x;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				DTYPE value = temp[0].data[i];
+				#pragma unroll
+				for (int j = 1; j < RW_CHANNELS; j++)
+				{
+					value += temp[j].data[i];
+				}
+				RW_PUT(index, value);
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			bx += BLOCK_X - 2 * halo;
+		}
+	}
+}
+
+#endif
+
+#endif // READS
@@ -0,0 +1,141 @@
+//====================================================================================================================================
+// Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Gather/Scatter
+// Data is accessed indirectly through index buffers generated by the host; every work-item, or iteration of single work-item
+// kernels, handles VEC consecutive indexes
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+// element type of the data buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+#define WGS 64
+
+//=====================================================================
+// NDRange Kernels
+//=====================================================================
+#ifdef NDR
+
+//=======================
+// Gather
+//=======================
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void GATHER(__global const DTYPE* restrict a,
+                     __global const int*   restrict b,
+                     __global       DTYPE* restrict d)
+{
+	long i = get_global_id(0) * VEC;
+
+	#pragma unroll
+	for (int j = 0; j < VEC; j++)
+	{
+		d[i + j] = a[b[i + j]];
+	}
+}
+
+//=======================
+// Scatter
+//=======================
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void SCATTER(__global const DTYPE* restrict a,
+                      __global const int*   restrict c,
+                      __global       DTYPE* restrict d)
+{
+	long i = get_global_id(0) * VEC;
+
+	#pragma unroll
+	for (int j = 0; j < VEC; j++)
+	{
+		d[c[i + j]] = a[i + j];
+	}
+}
+
+//=======================
+// Gather - Scatter
+//=======================
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void GS(__global const DTYPE* restrict a,
+                 __global const int*   restrict b,
+                 __global const int*   restrict c,
+                 __global       DTYPE* restrict d)
+{
+	long i = get_global_id(0) * VEC;
+
+	#pragma unroll
+	for (int j = 0; j < VEC; j++)
+	{
+		d[c[i + j]] = a[b[i + j]];
+	}
+}
+
+//=====================================================================
+// Single Work-item Kernels
+//=====================================================================
+#else
+
+//=======================
+// Gather
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void GATHER(__global const DTYPE* restrict a,
+                     __global const int*   restrict b,
+                     __global       DTYPE* restrict d,
+                              const long            exit)
+{
+	for (long i = 0; i < exit; i += VEC)
+	{
+		#pragma unroll
+		for (int j = 0; j < VEC; j++)
+		{
+			d[i + j] = a[b[i + j]];
+		}
+	}
+}
+
+//=======================
+// Scatter
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void SCATTER(__global const DTYPE* restrict a,
+                      __global const int*   restrict c,
+                      __global       DTYPE* restrict d,
+                               const long            exit)
+{
+	for (long i = 0; i < exit; i += VEC)
+	{
+		#pragma unroll
+		for (int j = 0; j < VEC; j++)
+		{
+			d[c[i + j]] = a[i + j];
+		}
+	}
+}
+
+//=======================
+// Gather - Scatter
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void GS(__global const DTYPE* restrict a,
+                 __global const int*   restrict b,
+                 __global const int*   restrict c,
+                 __global       DTYPE* restrict d,
+                          const long            exit)
+{
+	for (long i = 0; i < exit; i += VEC)
+	{
+		#pragma unroll
+		for (int j = 0; j < VEC; j++)
+		{
+			d[c[i + j]] = a[b[i + j]];
+		}
+	}
+}
+
+#endif
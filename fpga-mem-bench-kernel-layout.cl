@@ -0,0 +1,152 @@
+//====================================================================================================================================
+// Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Record layouts
+// Buffer a holds records of FIELDS fields in one of three layouts, and every kernel writes the sum of the fields of each record to
+// d, like R3W1 does for three separate arrays:
+//   SOA:   field f of record r at f * records + r, i.e. one array per field
+//   AOS:   field f of record r at r * FIELDS + f, i.e. whole records one after the other
+//   AOSOA: field f of record r at (r / tile) * tile * FIELDS + f * tile + r % tile, i.e. one array per field in every tile of records
+// Every work-item, or iteration of single work-item kernels, handles VEC consecutive records; "tile" is a power of two and a
+// multiple of VEC, so that the records of one access are always in the same tile
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+#ifndef FIELDS
+	#define FIELDS 3
+#endif
+
+#if FIELDS < 1 || FIELDS > 16
+	#error "FIELDS must be between 1 and 16"
+#endif
+
+#define WGS 64
+
+#define LAYOUT_SOA   0
+#define LAYOUT_AOS   1
+#define LAYOUT_AOSOA 2
+
+// Writes the sum of the fields of VEC consecutive records starting from "first"; "layout" is a constant at every call site, so
+// only the address computation of that layout is implemented
+inline void sum_fields(__global const DTYPE* restrict a, __global DTYPE* restrict d, const long first, const long records, const int tile, const int layout)
+{
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long r = first + i;
+		DTYPE sum = (DTYPE)0;
+
+		#pragma unroll
+		for (int f = 0; f < FIELDS; f++)
+		{
+			long index = (layout == LAYOUT_SOA) ? f * records + r :
+			             (layout == LAYOUT_AOS) ? r * FIELDS + f  :
+			             (r & ~(long)(tile - 1)) * FIELDS + f * tile + (r & (long)(tile - 1));
+			sum += a[index];
+		}
+
+		d[r] = sum;
+	}
+}
+
+//=====================================================================
+// NDRange Kernels
+//=====================================================================
+#ifdef NDR
+
+//=======================
+// Struct of Arrays
+//=======================
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void SOA(__global const DTYPE* restrict a,
+                  __global       DTYPE* restrict d,
+                           const long            records,
+                           const int             tile)
+{
+	sum_fields(a, d, get_global_id(0) * VEC, records, tile, LAYOUT_SOA);
+}
+
+//=======================
+// Array of Structs
+//=======================
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void AOS(__global const DTYPE* restrict a,
+                  __global       DTYPE* restrict d,
+                           const long            records,
+                           const int             tile)
+{
+	sum_fields(a, d, get_global_id(0) * VEC, records, tile, LAYOUT_AOS);
+}
+
+//=======================
+// Array of Structs of Arrays
+//=======================
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void AOSOA(__global const DTYPE* restrict a,
+                    __global       DTYPE* restrict d,
+                             const long            records,
+                             const int             tile)
+{
+	sum_fields(a, d, get_global_id(0) * VEC, records, tile, LAYOUT_AOSOA);
+}
+
+//=====================================================================
+// Single Work-item Kernels
+//=====================================================================
+#else
+
+//=======================
+// Struct of Arrays
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void SOA(__global const DTYPE* restrict a,
+                  __global       DTYPE* restrict d,
+                           const long            records,
+                           const int             tile)
+{
+	for (long first = 0; first < records; first += VEC)
+	{
+		sum_fields(a, d, first, records, tile, LAYOUT_SOA);
+	}
+}
+
+//=======================
+// Array of Structs
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void AOS(__global const DTYPE* restrict a,
+                  __global       DTYPE* restrict d,
+                           const long            records,
+                           const int             tile)
+{
+	for (long first = 0; first < records; first += VEC)
+	{
+		sum_fields(a, d, first, records, tile, LAYOUT_AOS);
+	}
+}
+
+//=======================
+// Array of Structs of Arrays
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void AOSOA(__global const DTYPE* restrict a,
+                    __global       DTYPE* restrict d,
+                             const long            records,
+                             const int             tile)
+{
+	for (long first = 0; first < records; first += VEC)
+	{
+		sum_fields(a, d, first, records, tile, LAYOUT_AOSOA);
+	}
+}
+
+#endif
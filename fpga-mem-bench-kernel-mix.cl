@@ -0,0 +1,93 @@
+//====================================================================================================================================
+// Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Read/write mix
+// Every index is read from the first "reads" buffers and their sum is written to the "writes" buffers that follow them, or 1.0 if
+// nothing is read; reads and writes are kernel arguments, so one kernel binary covers every read/write ratio of up to eight buffers
+// The load and store ports of all eight buffers are always implemented and the unused ones are predicated off, so the reads and
+// writes of every index are issued together from the same pipeline and compete for the memory controller
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+#define WGS 64
+
+// buffer k is read if it is one of the first "reads" buffers, and written if it is one of the "writes" buffers that follow them
+#define READ(k, buf)  if (k < reads) sum += buf[index];
+#define WRITE(k, buf) if (k >= reads && k < reads + writes) buf[index] = sum;
+
+#define MIX_INDEX(index)                                                                                                           \
+{                                                                                                                                  \
+	DTYPE sum = (reads > 0) ? (DTYPE)0 : (DTYPE)1;                                                                                 \
+	READ (0, a) READ (1, b) READ (2, c) READ (3, d) READ (4, e) READ (5, f) READ (6, g) READ (7, h)                                \
+	WRITE(0, a) WRITE(1, b) WRITE(2, c) WRITE(3, d) WRITE(4, e) WRITE(5, f) WRITE(6, g) WRITE(7, h)                                \
+}
+
+//=====================================================================
+// NDRange Kernel
+//=====================================================================
+#ifdef NDR
+
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void MIX(__global DTYPE* restrict a,
+                  __global DTYPE* restrict b,
+                  __global DTYPE* restrict c,
+                  __global DTYPE* restrict d,
+                  __global DTYPE* restrict e,
+                  __global DTYPE* restrict f,
+                  __global DTYPE* restrict g,
+                  __global DTYPE* restrict h,
+                           const int       pad,
+                           const long      groups,
+                           const int       reads,
+                           const int       writes)
+{
+	long group = get_global_id(0);
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long index = pad + group * VEC + i;
+		MIX_INDEX(index)
+	}
+}
+
+//=====================================================================
+// Single Work-item Kernel
+//=====================================================================
+#else
+
+__attribute__((max_global_work_dim(0)))
+__kernel void MIX(__global DTYPE* restrict a,
+                  __global DTYPE* restrict b,
+                  __global DTYPE* restrict c,
+                  __global DTYPE* restrict d,
+                  __global DTYPE* restrict e,
+                  __global DTYPE* restrict f,
+                  __global DTYPE* restrict g,
+                  __global DTYPE* restrict h,
+                           const int       pad,
+                           const long      groups,
+                           const int       reads,
+                           const int       writes)
+{
+	for (long group = 0; group < groups; group++)
+	{
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long index = pad + group * VEC + i;
+			MIX_INDEX(index)
+		}
+	}
+}
+
+#endif
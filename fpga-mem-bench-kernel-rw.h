@@ -0,0 +1,179 @@
+//====================================================================================================================================
+// Generated kernels with any number of reads and writes (RnWm), included by the kernel files of the std, blk2d and blk3d types and
+// their channelized versions instead of the standard kernels when READS (and optionally WRITES) is defined
+// Every output is written with the sum of all inputs, added in order, or with 1.0 if there are no inputs
+// Channelized read kernels send every input on its own channel, or the generated values on one channel if there are no inputs
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+#ifndef WRITES
+	#define WRITES 1
+#endif
+
+#define RW_MAX 8
+
+#if READS < 0 || READS > RW_MAX || WRITES < 1 || WRITES > RW_MAX
+	#error "READS must be between 0 and 8 and WRITES between 1 and 8"
+#endif
+
+// kernel names, e.g. R4W1, or R4W1_read and R4W1_write
+#define RW_PASTE(r, w, s)  R##r##W##w##s
+#define RW_EXPAND(r, w, s) RW_PASTE(r, w, s)
+#define RW_KERNEL          RW_EXPAND(READS, WRITES, )
+#define RW_READ            RW_EXPAND(READS, WRITES, _read)
+#define RW_WRITE           RW_EXPAND(READS, WRITES, _write)
+
+#define RW_CHANNELS ((READS > 0) ? READS : 1)
+
+//=======================
+// Inputs
+//=======================
+// RW_IN_k:              buffer argument of input k
+// RW_ADD_k(index):      input k added to the sum
+// RW_GET_k(temp, i, index): input k stored in position i of channel word k
+#if READS > 0
+	#define RW_IN_0                   __global const DTYPE* restrict in0,
+	#define RW_ADD_0(index)           in0[index]
+	#define RW_GET_0(temp, i, index)  temp[0].data[i] = in0[index];
+#else
+	#define RW_IN_0
+	#define RW_ADD_0(index)           (DTYPE)1
+	#define RW_GET_0(temp, i, index)  temp[0].data[i] = (DTYPE)1;
+#endif
+#if READS > 1
+	#define RW_IN_1                   __global const DTYPE* restrict in1,
+	#define RW_ADD_1(index)           + in1[index]
+	#define RW_GET_1(temp, i, index)  temp[1].data[i] = in1[index];
+#else
+	#define RW_IN_1
+	#define RW_ADD_1(index)
+	#define RW_GET_1(temp, i, index)
+#endif
+#if READS > 2
+	#define RW_IN_2                   __global const DTYPE* restrict in2,
+	#define RW_ADD_2(index)           + in2[index]
+	#define RW_GET_2(temp, i, index)  temp[2].data[i] = in2[index];
+#else
+	#define RW_IN_2
+	#define RW_ADD_2(index)
+	#define RW_GET_2(temp, i, index)
+#endif
+#if READS > 3
+	#define RW_IN_3                   __global const DTYPE* restrict in3,
+	#define RW_ADD_3(index)           + in3[index]
+	#define RW_GET_3(temp, i, index)  temp[3].data[i] = in3[index];
+#else
+	#define RW_IN_3
+	#define RW_ADD_3(index)
+	#define RW_GET_3(temp, i, index)
+#endif
+#if READS > 4
+	#define RW_IN_4                   __global const DTYPE* restrict in4,
+	#define RW_ADD_4(index)           + in4[index]
+	#define RW_GET_4(temp, i, index)  temp[4].data[i] = in4[index];
+#else
+	#define RW_IN_4
+	#define RW_ADD_4(index)
+	#define RW_GET_4(temp, i, index)
+#endif
+#if READS > 5
+	#define RW_IN_5                   __global const DTYPE* restrict in5,
+	#define RW_ADD_5(index)           + in5[index]
+	#define RW_GET_5(temp, i, index)  temp[5].data[i] = in5[index];
+#else
+	#define RW_IN_5
+	#define RW_ADD_5(index)
+	#define RW_GET_5(temp, i, index)
+#endif
+#if READS > 6
+	#define RW_IN_6                   __global const DTYPE* restrict in6,
+	#define RW_ADD_6(index)           + in6[index]
+	#define RW_GET_6(temp, i, index)  temp[6].data[i] = in6[index];
+#else
+	#define RW_IN_6
+	#define RW_ADD_6(index)
+	#define RW_GET_6(temp, i, index)
+#endif
+#if READS > 7
+	#define RW_IN_7                   __global const DTYPE* restrict in7,
+	#define RW_ADD_7(index)           + in7[index]
+	#define RW_GET_7(temp, i, index)  temp[7].data[i] = in7[index];
+#else
+	#define RW_IN_7
+	#define RW_ADD_7(index)
+	#define RW_GET_7(temp, i, index)
+#endif
+
+// buffer arguments of all inputs, each followed by a comma
+#define RW_INPUTS RW_IN_0 RW_IN_1 RW_IN_2 RW_IN_3 RW_IN_4 RW_IN_5 RW_IN_6 RW_IN_7
+
+// sum of all inputs at the given index
+#define RW_SUM(index) (RW_ADD_0(index) RW_ADD_1(index) RW_ADD_2(index) RW_ADD_3(index) RW_ADD_4(index) RW_ADD_5(index) RW_ADD_6(index) RW_ADD_7(index))
+
+// reads all inputs at the given index into position i of the channel words
+#define RW_GET(temp, i, index) RW_GET_0(temp, i, index) RW_GET_1(temp, i, index) RW_GET_2(temp, i, index) RW_GET_3(temp, i, index) \
+                               RW_GET_4(temp, i, index) RW_GET_5(temp, i, index) RW_GET_6(temp, i, index) RW_GET_7(temp, i, index)
+
+//=======================
+// Outputs
+//=======================
+// RW_OUT_k:             buffer argument of output k
+// RW_PUT_k(index, v):   v written to output k
+#define RW_OUT_0                      __global       DTYPE* restrict out0,
+#define RW_PUT_0(index, v)            out0[index] = v;
+#if WRITES > 1
+	#define RW_OUT_1                  __global       DTYPE* restrict out1,
+	#define RW_PUT_1(index, v)        out1[index] = v;
+#else
+	#define RW_OUT_1
+	#define RW_PUT_1(index, v)
+#endif
+#if WRITES > 2
+	#define RW_OUT_2                  __global       DTYPE* restrict out2,
+	#define RW_PUT_2(index, v)        out2[index] = v;
+#else
+	#define RW_OUT_2
+	#define RW_PUT_2(index, v)
+#endif
+#if WRITES > 3
+	#define RW_OUT_3                  __global       DTYPE* restrict out3,
+	#define RW_PUT_3(index, v)        out3[index] = v;
+#else
+	#define RW_OUT_3
+	#define RW_PUT_3(index, v)
+#endif
+#if WRITES > 4
+	#define RW_OUT_4                  __global       DTYPE* restrict out4,
+	#define RW_PUT_4(index, v)        out4[index] = v;
+#else
+	#define RW_OUT_4
+	#define RW_PUT_4(index, v)
+#endif
+#if WRITES > 5
+	#define RW_OUT_5                  __global       DTYPE* restrict out5,
+	#define RW_PUT_5(index, v)        out5[index] = v;
+#else
+	#define RW_OUT_5
+	#define RW_PUT_5(index, v)
+#endif
+#if WRITES > 6
+	#define RW_OUT_6                  __global       DTYPE* restrict out6,
+	#define RW_PUT_6(index, v)        out6[index] = v;
+#else
+	#define RW_OUT_6
+	#define RW_PUT_6(index, v)
+#endif
+#if WRITES > 7
+	#define RW_OUT_7                  __global       DTYPE* restrict out7,
+	#define RW_PUT_7(index, v)        out7[index] = v;
+#else
+	#define RW_OUT_7
+	#define RW_PUT_7(index, v)
+#endif
+
+// buffer arguments of all outputs, each followed by a comma
+#define RW_OUTPUTS RW_OUT_0 RW_OUT_1 RW_OUT_2 RW_OUT_3 RW_OUT_4 RW_OUT_5 RW_OUT_6 RW_OUT_7
+
+// writes v to all outputs at the given index
+#define RW_PUT(index, v) RW_PUT_0(index, v) RW_PUT_1(index, v) RW_PUT_2(index, v) RW_PUT_3(index, v) \
+                         RW_PUT_4(index, v) RW_PUT_5(index, v) RW_PUT_6(index, v) RW_PUT_7(index, v)
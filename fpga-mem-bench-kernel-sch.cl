@@ -1,8 +1,24 @@
 //====================================================================================================================================
 // Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Serial channel bandwidth for Nallatech 510T board
+// Every vector is sent in two halves, one per serial port, in one of these topologies:
+//   FPGA_1/FPGA_2: one way, the first FPGA sends and the second one receives; port n of both boards connected together
+//   DUPLEX:        both FPGAs send and receive at the same time, with the same cabling
+//   RING:          every FPGA sends to and receives from both neighbours; port 0 of every board connected to port 1 of the next
+// PINGPONG binaries replace the one-way kernels of FPGA_1 and FPGA_2 with a pair that bounces messages over port 0 and back
 // (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
 //====================================================================================================================================
 
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
 #ifdef LEGACY
 	#pragma OPENCL EXTENSION cl_altera_channels : enable
 	#define read_channel read_channel_altera
@@ -22,22 +38,48 @@
 
 typedef struct
 {
-	float data[HALF_VEC];
+	DTYPE data[HALF_VEC];
 } CHAN_WIDTH;
 
-#ifdef FPGA_1
+#if defined(DUPLEX) || defined(RING)
+	#define SENDER
+	#define RECEIVER
+#elif defined(PINGPONG)
+	// every channel has a single kernel at each end, so both ping-pong kernels use both directions of port 0
+#elif defined(FPGA_1)
+	#define SENDER
+#elif defined(FPGA_2)
+	#define RECEIVER
+#endif
+
+#if defined(SENDER) || defined(PINGPONG)
 channel CHAN_WIDTH sch_copy_out0 __attribute__((depth(DEPTH))) __attribute__((io("kernel_output_ch0" )));
+#endif
+#ifdef SENDER
 channel CHAN_WIDTH sch_copy_out1 __attribute__((depth(DEPTH))) __attribute__((io("kernel_output_ch1" )));
-#else
+#endif
+#if defined(RECEIVER) || defined(PINGPONG)
 channel CHAN_WIDTH sch_copy_in0  __attribute__((depth(DEPTH))) __attribute__((io("kernel_input_ch0")));
+#endif
+#ifdef RECEIVER
 channel CHAN_WIDTH sch_copy_in1  __attribute__((depth(DEPTH))) __attribute__((io("kernel_input_ch1")));
 #endif
 
+// in a ring, the first halves sent on port 0 arrive from the previous board on port 1, and the second halves sent on port 1 arrive
+// from the next board on port 0
+#ifdef RING
+	#define sch_first_in  sch_copy_in1
+	#define sch_second_in sch_copy_in0
+#else
+	#define sch_first_in  sch_copy_in0
+	#define sch_second_in sch_copy_in1
+#endif
+
 #ifdef NDR //NDRange kernels
 
-#ifdef FPGA_1
+#ifdef SENDER
 __attribute__((reqd_work_group_size(WGS, 1, 1)))
-__kernel void R1W1_read(__global const float* restrict a, const int pad)
+__kernel void R1W1_read(__global const DTYPE* restrict a, const int pad)
 {
 	int tid = get_global_id(0);
 	long i = tid * VEC;
@@ -53,17 +95,18 @@ __kernel void R1W1_read(__global const float* restrict a, const int pad)
 	write_channel(sch_copy_out0, temp0);
 	write_channel(sch_copy_out1, temp1);
 }
+#endif
 
-#elif FPGA_2
+#ifdef RECEIVER
 __attribute__((reqd_work_group_size(WGS, 1, 1)))
-__kernel void R1W1_write(__global float* restrict c, const int pad)
+__kernel void R1W1_write(__global DTYPE* restrict c, const int pad)
 {
 	int tid = get_global_id(0);
 	long i = tid * VEC;
 	CHAN_WIDTH temp0, temp1;
 
-	temp0 = read_channel(sch_copy_in0);
-	temp1 = read_channel(sch_copy_in1);
+	temp0 = read_channel(sch_first_in);
+	temp1 = read_channel(sch_second_in);
 
 	#pragma unroll
 	for (int j = 0; j < HALF_VEC; j++)
@@ -76,9 +119,9 @@ __kernel void R1W1_write(__global float* restrict c, const int pad)
 
 #else // Single Work-item kernels
 
-#ifdef FPGA_1
+#ifdef SENDER
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1_read(__global const float* restrict a, const int pad, const long size)
+__kernel void R1W1_read(__global const DTYPE* restrict a, const int pad, const long size)
 {
 	for (long i = 0; i != size; i += VEC)
 	{
@@ -95,17 +138,18 @@ __kernel void R1W1_read(__global const float* restrict a, const int pad, const l
 		write_channel(sch_copy_out1, temp1);
 	}
 }
+#endif
 
-#elif FPGA_2
+#ifdef RECEIVER
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1_write(__global float* restrict c, const int pad, const long size)
+__kernel void R1W1_write(__global DTYPE* restrict c, const int pad, const long size)
 {
 	for (long i = 0; i != size; i += VEC)
 	{
 		CHAN_WIDTH temp0, temp1;
 
-		temp0 = read_channel(sch_copy_in0);
-		temp1 = read_channel(sch_copy_in1);
+		temp0 = read_channel(sch_first_in);
+		temp1 = read_channel(sch_second_in);
 
 		#pragma unroll
 		for (int j = 0; j < HALF_VEC; j++)
@@ -117,4 +161,54 @@ __kernel void R1W1_write(__global float* restrict c, const int pad, const long s
 }
 #endif
 
-#endif
\ No newline at end of file
+#ifdef PINGPONG
+
+// Sends HALF_VEC elements of a at a time and waits for their echo before the next message, which depends on the echo so that round
+// trips cannot overlap
+#ifdef FPGA_1
+__attribute__((max_global_work_dim(0)))
+__kernel void PINGPONG_read(__global const DTYPE* restrict a, const long size)
+{
+	CHAN_WIDTH echo;
+
+	#pragma unroll
+	for (int j = 0; j < HALF_VEC; j++)
+	{
+		echo.data[j] = (DTYPE)0;
+	}
+
+	for (long i = 0; i != size; i += HALF_VEC)
+	{
+		CHAN_WIDTH temp;
+
+		#pragma unroll
+		for (int j = 0; j < HALF_VEC; j++)
+		{
+			temp.data[j] = a[i + j] + echo.data[j];
+		}
+
+		write_channel(sch_copy_out0, temp);
+		mem_fence(CLK_CHANNEL_MEM_FENCE);
+		echo = read_channel(sch_copy_in0);
+	}
+}
+
+// Returns every message to the board it came from
+#elif defined(FPGA_2)
+__attribute__((max_global_work_dim(0)))
+__kernel void PINGPONG_write(const long size)
+{
+	for (long i = 0; i != size; i += HALF_VEC)
+	{
+		CHAN_WIDTH temp;
+
+		temp = read_channel(sch_copy_in0);
+		mem_fence(CLK_CHANNEL_MEM_FENCE);
+		write_channel(sch_copy_out0, temp);
+	}
+}
+#endif
+
+#endif
+
+#endif
@@ -1,8 +1,22 @@
 //====================================================================================================================================
 // Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Standard
+// With READS defined, only the kernels generated from fpga-mem-bench-kernel-rw.h are compiled, with READS inputs and WRITES outputs
 // (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
 //====================================================================================================================================
 
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+#ifndef READS
+
 //=====================================================================
 // NDRange Kernels
 //=====================================================================
@@ -12,8 +26,8 @@
 // Read One - Write Zero
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R1W0(__global const float* restrict a,
-                   __global       float* restrict d,
+__kernel void R1W0(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const int             halo)
@@ -22,7 +36,7 @@ __kernel void R1W0(__global const float* restrict a,
 	int gidx = get_group_id(0);
 	long bx = gidx * (BLOCK_X - 2 * halo);
 	long gx = bx + x - halo;
-	float temp[VEC];
+	DTYPE temp[VEC];
 
 	#pragma unroll
 	for (int i = 0; i < VEC; i++)
@@ -50,8 +64,8 @@ __kernel void R1W0(__global const float* restrict a,
 // Read One - Write One
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R1W1(__global const float* restrict a,
-                   __global       float* restrict d,
+__kernel void R1W1(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const int             halo)
@@ -77,9 +91,9 @@ __kernel void R1W1(__global const float* restrict a,
 // Read Two - Write One
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R2W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict d,
+__kernel void R2W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const int             halo)
@@ -105,10 +119,10 @@ __kernel void R2W1(__global const float* restrict a,
 // Read Three - Write One
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R3W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global const float* restrict c,
-                   __global       float* restrict d,
+__kernel void R3W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global const DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const int             halo)
@@ -134,10 +148,10 @@ __kernel void R3W1(__global const float* restrict a,
 // Read Two - Write Two
 //=======================
 __attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
-__kernel void R2W2(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict c,
-                   __global       float* restrict d,
+__kernel void R2W2(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const int             halo)
@@ -160,6 +174,64 @@ __kernel void R2W2(__global const float* restrict a,
 	}
 }
 
+//=======================
+// Read Zero - Write One
+//=======================
+__attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
+__kernel void R0W1(__global       DTYPE* restrict d,
+                            const int             pad,
+                            const long            dim_x,
+                            const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	long bx = gidx * (BLOCK_X - 2 * halo);
+	long gx = bx + x - halo;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long real_x = gx + i;
+		long index = pad + real_x;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			d[index] = (DTYPE)1;
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
+__kernel void R1W1IP(__global       DTYPE* restrict c,
+                              const int             pad,
+                              const long            dim_x,
+                              const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	long bx = gidx * (BLOCK_X - 2 * halo);
+	long gx = bx + x - halo;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long real_x = gx + i;
+		long index = pad + real_x;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			DTYPE temp = c[index];
+
+			// halo indexes are only read, since they are written by the neighboring block
+			if (x + i >= halo && x + i < BLOCK_X - halo)
+			{
+				c[index] = temp + (DTYPE)1;
+			}
+		}
+	}
+}
+
 //=====================================================================
 // Single Work-item Kernels
 //=====================================================================
@@ -169,8 +241,8 @@ __kernel void R2W2(__global const float* restrict a,
 // Read One - Write Zero
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W0(__global const float* restrict a,
-                   __global       float* restrict d,
+__kernel void R1W0(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const long            exit,
@@ -184,7 +256,7 @@ __kernel void R1W0(__global const float* restrict a,
 	{
 		cond++;
 
-		float temp[VEC];
+		DTYPE temp[VEC];
 		long gx = bx + x - halo;
 		#pragma unroll
 		for (int i = 0; i < VEC; i++)
@@ -219,8 +291,8 @@ __kernel void R1W0(__global const float* restrict a,
 // Read One - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R1W1(__global const float* restrict a,
-                   __global       float* restrict d,
+__kernel void R1W1(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const long            exit,
@@ -259,9 +331,9 @@ __kernel void R1W1(__global const float* restrict a,
 // Read Two - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict d,
+__kernel void R2W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const long            exit,
@@ -300,10 +372,10 @@ __kernel void R2W1(__global const float* restrict a,
 // Read Three - Write One
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R3W1(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global const float* restrict c,
-                   __global       float* restrict d,
+__kernel void R3W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global const DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const long            exit,
@@ -342,10 +414,10 @@ __kernel void R3W1(__global const float* restrict a,
 // Read Two - Write Two
 //=======================
 __attribute__((max_global_work_dim(0)))
-__kernel void R2W2(__global const float* restrict a,
-                   __global const float* restrict b,
-                   __global       float* restrict c,
-                   __global       float* restrict d,
+__kernel void R2W2(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict c,
+                   __global       DTYPE* restrict d,
                             const int             pad,
                             const long            dim_x,
                             const long            exit,
@@ -381,4 +453,172 @@ __kernel void R2W2(__global const float* restrict a,
 	}
 }
 
-#endif
\ No newline at end of file
+//=======================
+// Read Zero - Write One
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R0W1(__global       DTYPE* restrict d,
+                            const int             pad,
+                            const long            dim_x,
+                            const long            exit,
+                            const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	long bx = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		long gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long real_x = gx + i;
+			long index = pad + real_x;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				d[index] = (DTYPE)1;
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			bx += BLOCK_X - 2 * halo;
+		}
+	}
+}
+
+//=======================
+// Read One - Write One, in place
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1IP(__global       DTYPE* restrict c,
+                              const int             pad,
+                              const long            dim_x,
+                              const long            exit,
+                              const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	long bx = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		long gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long real_x = gx + i;
+			long index = pad + real_x;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				DTYPE temp = c[index];
+
+				// halo indexes are only read, since they are written by the neighboring block
+				if (x + i >= halo && x + i < BLOCK_X - halo)
+				{
+					c[index] = temp + (DTYPE)1;
+				}
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			bx += BLOCK_X - 2 * halo;
+		}
+	}
+}
+
+#endif
+
+#else
+
+#include "fpga-mem-bench-kernel-rw.h"
+
+//=====================================================================
+// Generated Kernels
+//=====================================================================
+#ifdef NDR
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__attribute__((reqd_work_group_size(BLOCK_X / VEC, 1, 1)))
+__kernel void RW_KERNEL(RW_INPUTS
+                        RW_OUTPUTS
+                                 const int             pad,
+                                 const long            dim_x,
+                                 const int             halo)
+{
+	int x = get_local_id(0) * VEC;
+	int gidx = get_group_id(0);
+	long bx = gidx * (BLOCK_X - 2 * halo);
+	long gx = bx + x - halo;
+
+	#pragma unroll
+	for (int i = 0; i < VEC; i++)
+	{
+		long real_x = gx + i;
+		long index = pad + real_x;
+		if (real_x >= 0 && real_x < dim_x)
+		{
+			DTYPE value = RW_SUM(index);
+			RW_PUT(index, value);
+		}
+	}
+}
+
+#else
+
+//=======================
+// Read READS - Write WRITES
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void RW_KERNEL(RW_INPUTS
+                        RW_OUTPUTS
+                                 const int             pad,
+                                 const long            dim_x,
+                                 const long            exit,
+                                 const int             halo)
+{
+	long cond = 0;
+	int x = 0;
+	long bx = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		long gx = bx + x - halo;
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long real_x = gx + i;
+			long index = pad + real_x;
+			if (real_x >= 0 && real_x < dim_x)
+			{
+				DTYPE value = RW_SUM(index);
+				RW_PUT(index, value);
+			}
+		}
+
+		x = (x + VEC) & (BLOCK_X - 1);
+
+		if (x == 0)
+		{
+			bx += BLOCK_X - 2 * halo;
+		}
+	}
+}
+
+#endif
+
+#endif // READS
@@ -0,0 +1,262 @@
+//====================================================================================================================================
+// Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Strided
+// The array is accessed in groups of VEC consecutive indexes, and consecutive accesses are "stride" groups apart; the array is
+// traversed in "stride" passes, pass j accessing groups j, j + stride, j + 2 * stride, ..., so that every index is accessed
+// exactly once regardless of the stride
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+#define WGS 64
+
+//=====================================================================
+// NDRange Kernels
+//=====================================================================
+#ifdef NDR
+
+// Work-items of a work-group follow each other in the same pass; dimension 1 selects the pass
+
+//=======================
+// Read One - Write Zero
+//=======================
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void R1W0(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
+                            const int             pad,
+                            const long            groups,
+                            const long            rows,
+                            const int             stride)
+{
+	long row = get_global_id(0);
+	int pass = get_global_id(1);
+	long group = row * stride + pass;
+	DTYPE temp[VEC];
+
+	if (row < rows && group < groups)
+	{
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			temp[i] = a[pad + group * VEC + i];
+		}
+	}
+
+	// to prevent the compiler from optimizing out the memory accesses
+	if (row == 0 && pass == 0)
+	{
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			d[i] = temp[i];
+		}
+	}
+}
+
+//=======================
+// Read One - Write One
+//=======================
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void R1W1(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
+                            const int             pad,
+                            const long            groups,
+                            const long            rows,
+                            const int             stride)
+{
+	long row = get_global_id(0);
+	int pass = get_global_id(1);
+	long group = row * stride + pass;
+
+	if (row < rows && group < groups)
+	{
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long index = pad + group * VEC + i;
+			d[index] = a[index];
+		}
+	}
+}
+
+//=======================
+// Read Two - Write One
+//=======================
+__attribute__((reqd_work_group_size(WGS, 1, 1)))
+__kernel void R2W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict d,
+                            const int             pad,
+                            const long            groups,
+                            const long            rows,
+                            const int             stride)
+{
+	long row = get_global_id(0);
+	int pass = get_global_id(1);
+	long group = row * stride + pass;
+
+	if (row < rows && group < groups)
+	{
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long index = pad + group * VEC + i;
+			d[index] = a[index] + b[index];
+		}
+	}
+}
+
+//=====================================================================
+// Single Work-item Kernels
+//=====================================================================
+#else
+
+// The group index is advanced by the stride and restarted from the next pass after "rows" accesses, without multiplications
+
+//=======================
+// Read One - Write Zero
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W0(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
+                            const int             pad,
+                            const long            groups,
+                            const long            rows,
+                            const long            exit,
+                            const int             stride)
+{
+	long cond = 0;
+	long row = 0;
+	int pass = 0;
+	long group = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		DTYPE temp[VEC];
+		if (group < groups)
+		{
+			#pragma unroll
+			for (int i = 0; i < VEC; i++)
+			{
+				temp[i] = a[pad + group * VEC + i];
+			}
+		}
+
+		// to prevent the compiler from optimizing out the memory accesses
+		if (cond == 1)
+		{
+			#pragma unroll
+			for (int i = 0; i < VEC; i++)
+			{
+				d[i] = temp[i];
+			}
+		}
+
+		row++;
+		group += stride;
+		if (row == rows)
+		{
+			row = 0;
+			pass++;
+			group = pass;
+		}
+	}
+}
+
+//=======================
+// Read One - Write One
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R1W1(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
+                            const int             pad,
+                            const long            groups,
+                            const long            rows,
+                            const long            exit,
+                            const int             stride)
+{
+	long cond = 0;
+	long row = 0;
+	int pass = 0;
+	long group = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		if (group < groups)
+		{
+			#pragma unroll
+			for (int i = 0; i < VEC; i++)
+			{
+				long index = pad + group * VEC + i;
+				d[index] = a[index];
+			}
+		}
+
+		row++;
+		group += stride;
+		if (row == rows)
+		{
+			row = 0;
+			pass++;
+			group = pass;
+		}
+	}
+}
+
+//=======================
+// Read Two - Write One
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void R2W1(__global const DTYPE* restrict a,
+                   __global const DTYPE* restrict b,
+                   __global       DTYPE* restrict d,
+                            const int             pad,
+                            const long            groups,
+                            const long            rows,
+                            const long            exit,
+                            const int             stride)
+{
+	long cond = 0;
+	long row = 0;
+	int pass = 0;
+	long group = 0;
+
+	while (cond != exit)
+	{
+		cond++;
+
+		if (group < groups)
+		{
+			#pragma unroll
+			for (int i = 0; i < VEC; i++)
+			{
+				long index = pad + group * VEC + i;
+				d[index] = a[index] + b[index];
+			}
+		}
+
+		row++;
+		group += stride;
+		if (row == rows)
+		{
+			row = 0;
+			pass++;
+			group = pass;
+		}
+	}
+}
+
+#endif
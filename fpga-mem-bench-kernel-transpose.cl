@@ -0,0 +1,229 @@
+//====================================================================================================================================
+// Memory bandwidth benchmark kernel for OpenCL-capable FPGAs: Transpose
+// Matrix a of dim_y rows and dim_x columns is copied to d (COPY), or transposed to d with row-major reads and column-major writes
+// (TRANSPOSE) or through a TILE x TILE tile in local memory, so that both reads and writes are row-major (TILED)
+// Rows of a are dim_x + pad_x elements apart, rows of the transposed d are dim_y + pad_x elements apart; both dimensions are
+// multiples of TILE, and every work-item, or iteration of single work-item kernels, handles VEC consecutive columns of a tile row
+// (c) 2019, Hamid Reza Zohouri @ Tokyo Institute of Technology
+//====================================================================================================================================
+
+// elements per side of the tile, which also sets the work-group size of the NDRange kernels to TILE / VEC; the tile takes
+// TILE * TILE elements of local memory, so that it must stay small on both FPGAs and GPUs
+#ifndef TILE
+	#define TILE 64
+#endif
+
+// element type of the buffers, float unless built with DTYPE; double and half need the fp64 and fp16 extensions
+#ifndef DTYPE
+	#define DTYPE float
+#endif
+#ifdef cl_khr_fp64
+	#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+	#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+//=====================================================================
+// NDRange Kernels
+//=====================================================================
+#ifdef NDR
+
+// every work-group handles one tile, group x in the tile row of global y
+
+//=======================
+// Row-major Copy
+//=======================
+__attribute__((reqd_work_group_size(TILE / VEC, 1, 1)))
+__kernel void COPY(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
+                            const int             dim_x,
+                            const int             dim_y,
+                            const int             pad_x)
+{
+	int c = get_local_id(0) * VEC;
+	int tx = get_group_id(0) * TILE;
+	int ty = get_global_id(1) * TILE;
+
+	for (int r = 0; r < TILE; r++)
+	{
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			long index = (long)(ty + r) * (dim_x + pad_x) + tx + c + i;
+			d[index] = a[index];
+		}
+	}
+}
+
+//=======================
+// Direct Transpose
+//=======================
+__attribute__((reqd_work_group_size(TILE / VEC, 1, 1)))
+__kernel void TRANSPOSE(__global const DTYPE* restrict a,
+                        __global       DTYPE* restrict d,
+                                 const int             dim_x,
+                                 const int             dim_y,
+                                 const int             pad_x)
+{
+	int c = get_local_id(0) * VEC;
+	int tx = get_group_id(0) * TILE;
+	int ty = get_global_id(1) * TILE;
+
+	for (int r = 0; r < TILE; r++)
+	{
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			d[(long)(tx + c + i) * (dim_y + pad_x) + ty + r] = a[(long)(ty + r) * (dim_x + pad_x) + tx + c + i];
+		}
+	}
+}
+
+//=======================
+// Tiled Transpose
+//=======================
+__attribute__((reqd_work_group_size(TILE / VEC, 1, 1)))
+__kernel void TILED(__global const DTYPE* restrict a,
+                    __global       DTYPE* restrict d,
+                             const int             dim_x,
+                             const int             dim_y,
+                             const int             pad_x)
+{
+	__local DTYPE tile[TILE][TILE];
+
+	int c = get_local_id(0) * VEC;
+	int tx = get_group_id(0) * TILE;
+	int ty = get_global_id(1) * TILE;
+
+	for (int r = 0; r < TILE; r++)
+	{
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			tile[r][c + i] = a[(long)(ty + r) * (dim_x + pad_x) + tx + c + i];
+		}
+	}
+
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for (int r = 0; r < TILE; r++)
+	{
+		#pragma unroll
+		for (int i = 0; i < VEC; i++)
+		{
+			d[(long)(tx + r) * (dim_y + pad_x) + ty + c + i] = tile[c + i][r];
+		}
+	}
+}
+
+//=====================================================================
+// Single Work-item Kernels
+//=====================================================================
+#else
+
+// tiles are traversed in row-major order, and the rows of every tile in VEC-wide steps
+
+//=======================
+// Row-major Copy
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void COPY(__global const DTYPE* restrict a,
+                   __global       DTYPE* restrict d,
+                            const int             dim_x,
+                            const int             dim_y,
+                            const int             pad_x)
+{
+	for (int ty = 0; ty < dim_y; ty += TILE)
+	{
+		for (int tx = 0; tx < dim_x; tx += TILE)
+		{
+			for (int r = 0; r < TILE; r++)
+			{
+				for (int c = 0; c < TILE; c += VEC)
+				{
+					#pragma unroll
+					for (int i = 0; i < VEC; i++)
+					{
+						long index = (long)(ty + r) * (dim_x + pad_x) + tx + c + i;
+						d[index] = a[index];
+					}
+				}
+			}
+		}
+	}
+}
+
+//=======================
+// Direct Transpose
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void TRANSPOSE(__global const DTYPE* restrict a,
+                        __global       DTYPE* restrict d,
+                                 const int             dim_x,
+                                 const int             dim_y,
+                                 const int             pad_x)
+{
+	for (int ty = 0; ty < dim_y; ty += TILE)
+	{
+		for (int tx = 0; tx < dim_x; tx += TILE)
+		{
+			for (int r = 0; r < TILE; r++)
+			{
+				for (int c = 0; c < TILE; c += VEC)
+				{
+					#pragma unroll
+					for (int i = 0; i < VEC; i++)
+					{
+						d[(long)(tx + c + i) * (dim_y + pad_x) + ty + r] = a[(long)(ty + r) * (dim_x + pad_x) + tx + c + i];
+					}
+				}
+			}
+		}
+	}
+}
+
+//=======================
+// Tiled Transpose
+//=======================
+__attribute__((max_global_work_dim(0)))
+__kernel void TILED(__global const DTYPE* restrict a,
+                    __global       DTYPE* restrict d,
+                             const int             dim_x,
+                             const int             dim_y,
+                             const int             pad_x)
+{
+	__local DTYPE tile[TILE][TILE];
+
+	for (int ty = 0; ty < dim_y; ty += TILE)
+	{
+		for (int tx = 0; tx < dim_x; tx += TILE)
+		{
+			for (int r = 0; r < TILE; r++)
+			{
+				for (int c = 0; c < TILE; c += VEC)
+				{
+					#pragma unroll
+					for (int i = 0; i < VEC; i++)
+					{
+						tile[r][c + i] = a[(long)(ty + r) * (dim_x + pad_x) + tx + c + i];
+					}
+				}
+			}
+
+			for (int r = 0; r < TILE; r++)
+			{
+				for (int c = 0; c < TILE; c += VEC)
+				{
+					#pragma unroll
+					for (int i = 0; i < VEC; i++)
+					{
+						d[(long)(tx + r) * (dim_y + pad_x) + ty + c + i] = tile[c + i][r];
+					}
+				}
+			}
+		}
+	}
+}
+
+#endif